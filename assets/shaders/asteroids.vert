@@ -1,11 +1,22 @@
 #version 460 core
 
+// Normals (location 1) aren't read: float arenas store them as vec3 but quantized arenas as octahedral vec2, and nothing here lights
 layout (location = 0) in vec3 aPosition;
-layout (location = 1) in vec3 aNormal;
 layout (location = 2) in vec2 aTcoord;
 
+// One entry per draw of the batch (DrawData), row-major like the matrices SendMat4 uploads.
+// For quantized arenas world already applies the mesh's dequantize, so this shader draws either layout.
+struct DrawData
+{
+    mat4 world;
+};
+
+layout (std430, row_major, binding = 0) readonly buffer Draws
+{
+    DrawData draws[];
+};
+
 uniform mat4 u_orbit;
-uniform mat4 u_world[100];
 uniform mat4 u_mvp;
 uniform mat3 u_normal;
 
@@ -23,8 +34,7 @@ mat4 translate(vec3 delta)
 
 void main()
 {
-   int id = gl_InstanceID;
-   mat4 world = u_world[id];
+   mat4 world = draws[gl_DrawID].world;
    tcoord = aTcoord;
 
    gl_Position = u_mvp * u_orbit * world * vec4(aPosition, 1.0);
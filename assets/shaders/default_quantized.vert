@@ -0,0 +1,33 @@
+#version 460 core
+
+// default.vert for LAYOUT_QUANTIZED meshes: normalized unorm16 positions, snorm16 octahedral normals, half-float tcoords
+layout (location = 0) in vec3 aPosition;
+layout (location = 1) in vec2 aNormal;
+layout (location = 2) in vec2 aTcoord;
+
+uniform mat4 u_mvp;
+uniform mat4 u_world;
+uniform mat3 u_normal;
+uniform mat4 u_dequantize;
+
+out vec3 position;
+out vec3 normal;
+out vec2 tcoord;
+
+vec3 octDecode(vec2 e)
+{
+   vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+   float t = max(-n.z, 0.0);
+   n.xy += vec2(n.x >= 0.0 ? -t : t, n.y >= 0.0 ? -t : t);
+   return normalize(n);
+}
+
+void main()
+{
+   vec4 objectPosition = u_dequantize * vec4(aPosition, 1.0);
+   position = (u_world * objectPosition).xyz;
+   normal = u_normal * octDecode(aNormal);
+   tcoord = aTcoord;
+
+   gl_Position = u_mvp * objectPosition;
+}
@@ -0,0 +1,18 @@
+#version 460 core
+
+// skybox.vert for LAYOUT_QUANTIZED meshes: normalized unorm16 positions, expanded to object space by u_dequantize
+layout (location = 0) in vec3 aPosition;
+
+uniform mat4 u_mvp;
+uniform mat4 u_dequantize;
+
+out vec3 position;
+
+void main()
+{
+   // Vertex positions are effectively texture coordinates when rendering a skybox!
+   vec4 objectPosition = u_dequantize * vec4(aPosition, 1.0);
+   position = objectPosition.xyz;
+
+   gl_Position = u_mvp * objectPosition;
+}
@@ -0,0 +1,475 @@
+// Math.h / MathSimd.h microbenchmarks. GPU-free, runs anywhere the math headers compile.
+//
+// Usage: MathBench [--filter <substring>] [--time <ms per benchmark>] [--json <file>] [--mesh <obj path>]
+// Prints a table of ns/op and ops/s for every scalar & vectorized variant, optionally writes the same
+// results as JSON for CI trend tracking. Exits with 1 if a vectorized variant disagrees with its scalar reference.
+
+#define FAST_OBJ_IMPLEMENTATION
+#include <fast_obj.h>
+#include "MathSimd.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+//----------------------------------------------------------------------------------
+// Harness
+//----------------------------------------------------------------------------------
+
+#if defined(_MSC_VER)
+volatile char g_sink;
+template<typename T> inline void DoNotOptimize(const T& value)
+{
+    g_sink = *(const volatile char*)&value;
+    _ReadWriteBarrier();
+}
+#else
+template<typename T> inline void DoNotOptimize(const T& value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+#endif
+
+struct BenchResult {
+    std::string name;
+    std::string variant;
+    double nsPerOp;
+    double opsPerSecond;
+    long long ops;
+};
+
+struct BenchOptions {
+    const char* filter = nullptr;
+    const char* jsonPath = nullptr;
+    const char* meshPath = "assets/meshes/head.obj";
+    double secondsPerBench = 0.2;
+};
+
+static BenchOptions g_options;
+static std::vector<BenchResult> g_results;
+static int g_failures = 0;
+
+// Times fn (which performs opsPerCall operations) and records the median of 5 samples
+template<typename Fn>
+void Bench(const char* name, const char* variant, int opsPerCall, Fn fn)
+{
+    std::string fullName = std::string(name) + "/" + variant;
+    if (g_options.filter != nullptr && fullName.find(g_options.filter) == std::string::npos)
+        return;
+
+    typedef std::chrono::steady_clock Clock;
+
+    // Grow the batch until one sample takes at least 1/5 of the time budget
+    long long calls = 1;
+    for (;;)
+    {
+        Clock::time_point start = Clock::now();
+        for (long long i = 0; i < calls; i++)
+            fn();
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        if (seconds >= g_options.secondsPerBench / 5.0 || calls >= (1ll << 40))
+            break;
+        calls *= 2;
+    }
+
+    double samples[5];
+    for (double& sample : samples)
+    {
+        Clock::time_point start = Clock::now();
+        for (long long i = 0; i < calls; i++)
+            fn();
+        sample = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / (double)(calls * opsPerCall);
+    }
+    std::sort(samples, samples + 5);
+
+    BenchResult result = { name, variant, samples[2], 1.0e9 / samples[2], calls * opsPerCall * 5 };
+    printf("%-24s %-12s %12.3f ns/op %14.0f ops/s\n", name, variant, result.nsPerOp, result.opsPerSecond);
+    fflush(stdout);
+    g_results.push_back(result);
+}
+
+// Records a failure if a vectorized result differs from the scalar reference by more than tolerance
+void Check(const char* name, const float* expected, const float* actual, int count, float tolerance)
+{
+    float maxError = 0.0f;
+    for (int i = 0; i < count; i++)
+        maxError = Max(maxError, Abs(expected[i] - actual[i]));
+
+    if (maxError > tolerance)
+    {
+        printf("CHECK FAILED: %s max error %g > %g\n", name, maxError, tolerance);
+        g_failures++;
+    }
+}
+
+const char* BackendName()
+{
+#if defined(MATH_AVX)
+    return "avx";
+#elif defined(MATH_SSE)
+    return "sse";
+#elif defined(MATH_NEON)
+    return "neon";
+#else
+    return "scalar";
+#endif
+}
+
+bool WriteJson(const char* path)
+{
+    FILE* file = fopen(path, "w");
+    if (file == nullptr)
+        return false;
+
+    fprintf(file, "{\n  \"backend\": \"%s\",\n  \"results\": [\n", BackendName());
+    for (size_t i = 0; i < g_results.size(); i++)
+    {
+        const BenchResult& r = g_results[i];
+        fprintf(file, "    { \"name\": \"%s\", \"variant\": \"%s\", \"ns_per_op\": %.4f, \"ops_per_second\": %.1f, \"ops\": %lld }%s\n",
+            r.name.c_str(), r.variant.c_str(), r.nsPerOp, r.opsPerSecond, r.ops, i + 1 < g_results.size() ? "," : "");
+    }
+    fprintf(file, "  ],\n  \"failures\": %d\n}\n", g_failures);
+    fclose(file);
+    return true;
+}
+
+//----------------------------------------------------------------------------------
+// Inputs
+//----------------------------------------------------------------------------------
+
+// Power of two so benchmarks can cycle through inputs with a mask
+const int N = 1024;
+
+struct Inputs {
+    std::vector<Matrix> matrices;
+    std::vector<Quaternion> quaternions;
+    std::vector<Vector3> vectors;
+    std::vector<float> angles;
+};
+
+Inputs CreateInputs()
+{
+    Inputs in;
+    in.matrices.resize(N);
+    in.quaternions.resize(N);
+    in.vectors.resize(N);
+    in.angles.resize(N);
+
+    RandomRotations(1, in.quaternions.data(), N);
+    RandomFill(2, in.angles.data(), N, -PI, PI);
+    Rng rng = CreateRng(3);
+    for (int i = 0; i < N; i++)
+    {
+        Vector3 t = { Random(&rng, -10.0f, 10.0f), Random(&rng, -10.0f, 10.0f), Random(&rng, -10.0f, 10.0f) };
+        Vector3 s = { Random(&rng, 0.5f, 2.0f), Random(&rng, 0.5f, 2.0f), Random(&rng, 0.5f, 2.0f) };
+        in.matrices[i] = Scale(s) * ToMatrix(in.quaternions[i]) * Translate(t);
+        in.vectors[i] = { Random(&rng, -10.0f, 10.0f), Random(&rng, -10.0f, 10.0f), Random(&rng, -10.0f, 10.0f) };
+    }
+    return in;
+}
+
+std::vector<Vector3> LoadPositions(const char* path)
+{
+    std::vector<Vector3> positions;
+    fastObjMesh* obj = fast_obj_read(path);
+    if (obj == nullptr)
+        return positions;
+
+    // Index-expanded like CreateMesh, so the counts match what the renderer transforms
+    positions.resize(obj->index_count);
+    for (unsigned int i = 0; i < obj->index_count; i++)
+        positions[i] = ((Vector3*)obj->positions)[obj->indices[i].p];
+    fast_obj_destroy(obj);
+    return positions;
+}
+
+//----------------------------------------------------------------------------------
+// Benchmarks
+//----------------------------------------------------------------------------------
+
+void BenchMatrices(const Inputs& in)
+{
+    const Matrix* m = in.matrices.data();
+    int i = 0;
+
+    Bench("Multiply", "scalar", 1, [&] { DoNotOptimize(MultiplyScalar(m[i], m[(i + 1) & (N - 1)])); i = (i + 1) & (N - 1); });
+    Bench("Multiply", "simd", 1, [&] { DoNotOptimize(MultiplySimd(m[i], m[(i + 1) & (N - 1)])); i = (i + 1) & (N - 1); });
+    Bench("Multiply", "wide8", 8, [&]
+    {
+        Matrixx8 a = Matrixx8::Load(m + i), b = Matrixx8::Load(m + ((i + 8) & (N - 1)));
+        DoNotOptimize(Multiply(a, b));
+        i = (i + 8) & (N - 1);
+    });
+
+    Bench("Transpose", "scalar", 1, [&] { DoNotOptimize(TransposeScalar(m[i])); i = (i + 1) & (N - 1); });
+    Bench("Transpose", "simd", 1, [&] { DoNotOptimize(TransposeSimd(m[i])); i = (i + 1) & (N - 1); });
+
+    Bench("Invert", "scalar", 1, [&] { DoNotOptimize(InvertScalar(m[i])); i = (i + 1) & (N - 1); });
+    Bench("Invert", "simd", 1, [&] { DoNotOptimize(InvertSimd(m[i])); i = (i + 1) & (N - 1); });
+    Bench("Invert", "affine", 1, [&] { DoNotOptimize(Invert(ToTransform(m[i]))); i = (i + 1) & (N - 1); });
+    Bench("Invert", "wide8", 8, [&] { DoNotOptimize(Invert(Matrixx8::Load(m + i))); i = (i + 8) & (N - 1); });
+
+    const Vector3* v = in.vectors.data();
+    Bench("LookAt", "scalar", 1, [&] { DoNotOptimize(LookAt(v[i], v[(i + 1) & (N - 1)], V3_UP)); i = (i + 1) & (N - 1); });
+
+    Matrix product[N], productSimd[N];
+    for (int j = 0; j < N; j++)
+    {
+        product[j] = MultiplyScalar(m[j], m[(j + 1) & (N - 1)]);
+        productSimd[j] = MultiplySimd(m[j], m[(j + 1) & (N - 1)]);
+    }
+    Check("Multiply simd", &product[0].m0, &productSimd[0].m0, N * 16, 0.0f);
+
+    Matrix inverse[N], inverseSimd[N];
+    for (int j = 0; j < N; j++)
+    {
+        inverse[j] = InvertScalar(m[j]);
+        inverseSimd[j] = InvertSimd(m[j]);
+    }
+    Check("Invert simd", &inverse[0].m0, &inverseSimd[0].m0, N * 16, 1.0e-3f);
+}
+
+void BenchQuaternions(const Inputs& in)
+{
+    const Quaternion* q = in.quaternions.data();
+    const float* a = in.angles.data();
+    int i = 0;
+
+    Bench("Slerp", "scalar", 1, [&] { DoNotOptimize(Slerp(q[i], q[(i + 1) & (N - 1)], 0.3f)); i = (i + 1) & (N - 1); });
+    Bench("Nlerp", "scalar", 1, [&] { DoNotOptimize(Nlerp(q[i], q[(i + 1) & (N - 1)], 0.3f)); i = (i + 1) & (N - 1); });
+    Bench("Nlerp", "wide8", 8, [&]
+    {
+        DoNotOptimize(Nlerp(Quaternionx8::Load(q + i), Quaternionx8::Load(q + ((i + 8) & (N - 1))), 0.3f));
+        i = (i + 8) & (N - 1);
+    });
+
+    Bench("FromEuler+ToMatrix", "scalar", 1, [&]
+    {
+        DoNotOptimize(ToMatrix(FromEuler(a[i], a[(i + 1) & (N - 1)], a[(i + 2) & (N - 1)])));
+        i = (i + 1) & (N - 1);
+    });
+    Bench("ToMatrix", "scalar", 1, [&] { DoNotOptimize(ToMatrix(q[i])); i = (i + 1) & (N - 1); });
+    Bench("ToMatrix", "wide8", 8, [&] { DoNotOptimize(ToMatrix(Quaternionx8::Load(q + i))); i = (i + 8) & (N - 1); });
+}
+
+void BenchVectors(const Inputs& in)
+{
+    std::vector<Vector3> out(N), reference(N);
+    const Vector3* v = in.vectors.data();
+
+    // References & checked outputs are computed outside Bench, so checks hold whichever variants --filter runs
+    for (int j = 0; j < N; j++)
+        reference[j] = Normalize(v[j]);
+
+    Bench("Normalize", "scalar", N, [&]
+    {
+        for (int j = 0; j < N; j++)
+            out[j] = Normalize(v[j]);
+        DoNotOptimize(out[0]);
+    });
+
+    Bench("Normalize", "batched", N, [&] { Normalize(v, out.data(), N); DoNotOptimize(out[0]); });
+    Normalize(v, out.data(), N);
+    Check("Normalize batched", &reference[0].x, &out[0].x, N * 3, 1.0e-6f);
+
+    Bench("Normalize", "wide8", N, [&]
+    {
+        for (int j = 0; j < N; j += 8)
+            Normalize(Vector3x8::Load(v + j)).Store(out.data() + j);
+        DoNotOptimize(out[0]);
+    });
+
+    const float* a = in.angles.data();
+    std::vector<float> s(N), c(N), sRef(N), cRef(N);
+    for (int j = 0; j < N; j++)
+    {
+        sRef[j] = sinf(a[j]);
+        cRef[j] = cosf(a[j]);
+    }
+
+    Bench("SinCos", "libm", N, [&]
+    {
+        for (int j = 0; j < N; j++)
+        {
+            s[j] = sinf(a[j]);
+            c[j] = cosf(a[j]);
+        }
+        DoNotOptimize(s[0]);
+    });
+    Bench("SinCos", "batched", N, [&] { SinCos(a, s.data(), c.data(), N); DoNotOptimize(s[0]); });
+    SinCos(a, s.data(), c.data(), N);
+    Check("SinCos batched", sRef.data(), s.data(), N, 2.0e-7f);
+    Check("SinCos batched", cRef.data(), c.data(), N, 2.0e-7f);
+
+    Bench("Random", "scalar", N, [&]
+    {
+        for (int j = 0; j < N; j++)
+            s[j] = Random(-1.0f, 1.0f);
+        DoNotOptimize(s[0]);
+    });
+    Bench("Random", "batched", N, [&] { RandomFill(7, s.data(), N, -1.0f, 1.0f); DoNotOptimize(s[0]); });
+}
+
+void BenchTransforms(const Inputs& in)
+{
+    std::vector<Vector3> positions = LoadPositions(g_options.meshPath);
+    if (positions.empty())
+    {
+        printf("(skipping TransformPoints: could not load %s)\n", g_options.meshPath);
+        return;
+    }
+
+    int count = (int)positions.size();
+    std::vector<Vector3> out(count), reference(count);
+    Matrix mat = in.matrices[0];
+    for (int j = 0; j < count; j++)
+        reference[j] = Multiply(positions[j], mat);
+
+    Bench("TransformPoints", "scalar", count, [&]
+    {
+        for (int j = 0; j < count; j++)
+            out[j] = Multiply(positions[j], mat);
+        DoNotOptimize(out[0]);
+    });
+
+    Bench("TransformPoints", "batched", count, [&] { TransformPoints(mat, positions.data(), out.data(), count); DoNotOptimize(out[0]); });
+    TransformPoints(mat, positions.data(), out.data(), count);
+    Check("TransformPoints batched", &reference[0].x, &out[0].x, count * 3, 0.0f);
+
+    // Same points as separate x, y & z arrays, the layout the vectorized transform wants
+    std::vector<float> x(count), y(count), z(count), outX(count), outY(count), outZ(count);
+    for (int j = 0; j < count; j++)
+    {
+        x[j] = positions[j].x;
+        y[j] = positions[j].y;
+        z[j] = positions[j].z;
+    }
+    Bench("TransformPoints", "soa", count, [&]
+    {
+        TransformPoints(mat, x.data(), y.data(), z.data(), outX.data(), outY.data(), outZ.data(), count);
+        DoNotOptimize(outX[0]);
+    });
+    TransformPoints(mat, x.data(), y.data(), z.data(), outX.data(), outY.data(), outZ.data(), count);
+    for (int j = 0; j < count; j++)
+        out[j] = { outX[j], outY[j], outZ[j] };
+    Check("TransformPoints soa", &reference[0].x, &out[0].x, count * 3, 0.0f);
+}
+
+void BenchCulling()
+{
+    const int count = 100000;
+    std::vector<float> x(count), y(count), z(count), r(count);
+    RandomFill(11, x.data(), count, -100.0f, 100.0f);
+    RandomFill(12, y.data(), count, -100.0f, 100.0f);
+    RandomFill(13, z.data(), count, -100.0f, 100.0f);
+    RandomFill(14, r.data(), count, 0.1f, 5.0f);
+
+    ViewFrustum frustum = ExtractFrustum(LookAt({ 10.0f, 5.0f, 30.0f }, V3_ZERO, V3_UP) * Perspective(60.0 * DEG2RAD, 16.0 / 9.0, 0.1, 150.0));
+    std::vector<int> visible(count);
+    int visibleCount = 0;
+    int reference = 0;
+    for (int j = 0; j < count; j++)
+        reference += SphereInFrustum(frustum, { x[j], y[j], z[j] }, r[j]) ? 1 : 0;
+
+    Bench("CullSpheres 100k", "scalar", count, [&]
+    {
+        visibleCount = 0;
+        for (int j = 0; j < count; j++)
+        {
+            visible[visibleCount] = j;
+            visibleCount += SphereInFrustum(frustum, { x[j], y[j], z[j] }, r[j]) ? 1 : 0;
+        }
+        DoNotOptimize(visibleCount);
+    });
+
+    Bench("CullSpheres 100k", "batched", count, [&]
+    {
+        visibleCount = CullSpheres(frustum, x.data(), y.data(), z.data(), r.data(), count, visible.data());
+        DoNotOptimize(visibleCount);
+    });
+
+    visibleCount = CullSpheres(frustum, x.data(), y.data(), z.data(), r.data(), count, visible.data());
+    if (visibleCount != reference)
+    {
+        printf("CHECK FAILED: CullSpheres batched found %d visible, scalar %d\n", visibleCount, reference);
+        g_failures++;
+    }
+}
+
+void BenchBounds(const Inputs& in)
+{
+    // Instanced set: one object-space sphere under N world matrices
+    Vector3 center = { 0.1f, -0.2f, 0.3f };
+    float radius = 1.5f;
+    std::vector<float> x(N), y(N), z(N), r(N), reference(N * 2);
+    for (int j = 0; j < N; j++)
+    {
+        reference[j] = Multiply(center, in.matrices[j]).x;
+        reference[N + j] = MaxAxisScale(in.matrices[j]) * radius;
+    }
+
+    Bench("TransformSpheres", "scalar", N, [&]
+    {
+        for (int j = 0; j < N; j++)
+        {
+            Vector3 p = Multiply(center, in.matrices[j]);
+            x[j] = p.x;
+            y[j] = p.y;
+            z[j] = p.z;
+            r[j] = MaxAxisScale(in.matrices[j]) * radius;
+        }
+        DoNotOptimize(x[0]);
+    });
+
+    Bench("TransformSpheres", "batched", N, [&]
+    {
+        TransformSpheres(in.matrices.data(), N, center, radius, x.data(), y.data(), z.data(), r.data());
+        DoNotOptimize(x[0]);
+    });
+    TransformSpheres(in.matrices.data(), N, center, radius, x.data(), y.data(), z.data(), r.data());
+    Check("TransformSpheres batched centers", reference.data(), x.data(), N, 0.0f);
+    Check("TransformSpheres batched radii", reference.data() + N, r.data(), N, 0.0f);
+}
+
+int main(int argc, char** argv)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+            g_options.filter = argv[++i];
+        else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+            g_options.jsonPath = argv[++i];
+        else if (strcmp(argv[i], "--mesh") == 0 && i + 1 < argc)
+            g_options.meshPath = argv[++i];
+        else if (strcmp(argv[i], "--time") == 0 && i + 1 < argc)
+            g_options.secondsPerBench = atof(argv[++i]) / 1000.0;
+        else
+        {
+            printf("Usage: %s [--filter <substring>] [--time <ms per benchmark>] [--json <file>] [--mesh <obj path>]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    printf("Math benchmarks (%s backend)\n", BackendName());
+    Inputs inputs = CreateInputs();
+    BenchMatrices(inputs);
+    BenchQuaternions(inputs);
+    BenchVectors(inputs);
+    BenchTransforms(inputs);
+    BenchCulling();
+    BenchBounds(inputs);
+
+    if (g_options.jsonPath != nullptr && !WriteJson(g_options.jsonPath))
+    {
+        printf("Could not write %s\n", g_options.jsonPath);
+        return 2;
+    }
+    return g_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,313 @@
+// Math.h / MathSimd.h accuracy tests. GPU-free, registered with CTest by bench/CMakeLists.txt.
+//
+// Usage: MathTest
+// Compares every vectorized matrix kernel of the compiled backend (SSE, AVX or NEON) against the scalar reference path,
+// and the sqrt, rsqrt, sin & cos kernels against double precision libm, and prints the worst error of each. Exits with 1 if any exceeds its tolerance.
+
+#include "MathSimd.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+//----------------------------------------------------------------------------------
+// Harness
+//----------------------------------------------------------------------------------
+
+static int g_failures = 0;
+
+// Distance between two floats in units in the last place (0 if bit-identical, adjacent floats are 1 apart)
+int64_t UlpDistance(float a, float b)
+{
+    int32_t ia, ib;
+    memcpy(&ia, &a, sizeof(float));
+    memcpy(&ib, &b, sizeof(float));
+    int64_t oa = ia < 0 ? (int64_t)INT32_MIN - ia : ia;
+    int64_t ob = ib < 0 ? (int64_t)INT32_MIN - ib : ib;
+    return oa > ob ? oa - ob : ob - oa;
+}
+
+void Report(const char* name, double error, double tolerance, const char* unit)
+{
+    bool pass = error <= tolerance;
+    printf("%-34s max %-10g tolerance %-10g %-8s %s\n", name, error, tolerance, unit, pass ? "ok" : "FAILED");
+    fflush(stdout);
+    if (!pass)
+        g_failures++;
+}
+
+// Worst ULP distance between matching elements of count matrices
+int64_t MaxUlps(const Matrix* expected, const Matrix* actual, int count)
+{
+    int64_t worst = 0;
+    for (int i = 0; i < count; i++)
+    {
+        const float* e = &expected[i].m0;
+        const float* a = &actual[i].m0;
+        for (int j = 0; j < 16; j++)
+            worst = std::max(worst, UlpDistance(e[j], a[j]));
+    }
+    return worst;
+}
+
+// Double precision inverse (Gauss-Jordan with partial pivoting) as the reference both float paths are measured against
+void InvertDouble(const Matrix& mat, double* inverse)
+{
+    double m[4][8];
+    for (int r = 0; r < 4; r++)
+    {
+        for (int c = 0; c < 4; c++)
+        {
+            m[r][c] = (&mat.m0)[r * 4 + c];
+            m[r][c + 4] = r == c ? 1.0 : 0.0;
+        }
+    }
+
+    for (int c = 0; c < 4; c++)
+    {
+        int pivot = c;
+        for (int r = c + 1; r < 4; r++)
+            pivot = fabs(m[r][c]) > fabs(m[pivot][c]) ? r : pivot;
+        for (int k = 0; k < 8; k++)
+            std::swap(m[c][k], m[pivot][k]);
+
+        double d = m[c][c];
+        for (int k = 0; k < 8; k++)
+            m[c][k] /= d;
+        for (int r = 0; r < 4; r++)
+        {
+            double f = r == c ? 0.0 : m[r][c];
+            for (int k = 0; k < 8; k++)
+                m[r][k] -= f * m[c][k];
+        }
+    }
+
+    for (int r = 0; r < 4; r++)
+        for (int c = 0; c < 4; c++)
+            inverse[r * 4 + c] = m[r][c + 4];
+}
+
+// Worst inverse error of count matrices in units of FLT_EPSILON * condition number (infinity norm), relative to the largest
+// element of the exact inverse. Backward-stable inversions stay below about 1 on this scale however ill-conditioned the input.
+double MaxInverseError(const Matrix* matrices, const Matrix* inverses, int count)
+{
+    double worst = 0.0;
+    for (int i = 0; i < count; i++)
+    {
+        double exact[16];
+        InvertDouble(matrices[i], exact);
+
+        double norm = 0.0, inverseNorm = 0.0, largest = 0.0;
+        for (int r = 0; r < 4; r++)
+        {
+            double row = 0.0, inverseRow = 0.0;
+            for (int c = 0; c < 4; c++)
+            {
+                row += fabs((&matrices[i].m0)[r * 4 + c]);
+                inverseRow += fabs(exact[r * 4 + c]);
+                largest = std::max(largest, fabs(exact[r * 4 + c]));
+            }
+            norm = std::max(norm, row);
+            inverseNorm = std::max(inverseNorm, inverseRow);
+        }
+
+        double error = 0.0;
+        for (int j = 0; j < 16; j++)
+            error = std::max(error, fabs((&inverses[i].m0)[j] - exact[j]) / largest);
+        worst = std::max(worst, error / (FLT_EPSILON * norm * inverseNorm));
+    }
+    return worst;
+}
+
+const char* BackendName()
+{
+#if defined(MATH_AVX)
+    return "avx";
+#elif defined(MATH_SSE)
+    return "sse";
+#elif defined(MATH_NEON)
+    return "neon";
+#else
+    return "scalar";
+#endif
+}
+
+//----------------------------------------------------------------------------------
+// Inputs
+//----------------------------------------------------------------------------------
+
+// Multiple of 8 so the wide kernels cover every matrix
+const int N = 4096;
+
+// Transforms like the renderer's (scale * rotation * translation) and dense matrices with every element in [-1, 1].
+// Dense ones are conditioned well enough to invert: each is redrawn until |det| >= 0.05.
+std::vector<Matrix> CreateMatrices()
+{
+    std::vector<Matrix> matrices(N);
+    std::vector<Quaternion> rotations(N / 2);
+    RandomRotations(1, rotations.data(), N / 2);
+    Rng rng = CreateRng(2);
+    for (int i = 0; i < N / 2; i++)
+    {
+        Vector3 t = { Random(&rng, -50.0f, 50.0f), Random(&rng, -50.0f, 50.0f), Random(&rng, -50.0f, 50.0f) };
+        Vector3 s = { Random(&rng, 0.1f, 10.0f), Random(&rng, 0.1f, 10.0f), Random(&rng, 0.1f, 10.0f) };
+        matrices[i] = Scale(s) * ToMatrix(rotations[i]) * Translate(t);
+    }
+
+    for (int i = N / 2; i < N; i++)
+    {
+        do
+        {
+            float* m = &matrices[i].m0;
+            for (int j = 0; j < 16; j++)
+                m[j] = Random(&rng, -1.0f, 1.0f);
+        } while (fabsf(Determinant(matrices[i])) < 0.05f);
+    }
+    return matrices;
+}
+
+//----------------------------------------------------------------------------------
+// Tests
+//----------------------------------------------------------------------------------
+
+// Multiply & Transpose reorder the same operations as the scalar path, so they must be bit-identical (no FMA contraction
+// is enabled), as must the wide kernels. InvertSimd uses a block-wise 2x2 expansion instead of cofactors, so it can't match
+// bit for bit: it's held to the scalar path's own accuracy bound instead, 1 eps * cond(M) from a double precision inverse
+// (both measure about 0.35 on these inputs).
+void TestMatrices(const std::vector<Matrix>& m)
+{
+    std::vector<Matrix> expected(N), actual(N);
+
+    for (int i = 0; i < N; i++)
+    {
+        expected[i] = MultiplyScalar(m[i], m[(i + 1) % N]);
+        actual[i] = MultiplySimd(m[i], m[(i + 1) % N]);
+    }
+    Report("Multiply simd", (double)MaxUlps(expected.data(), actual.data(), N), 0.0, "ulps");
+
+    for (int i = 0; i < N; i += 8)
+        Multiply(Matrixx8::Load(&m[i]), Matrixx8::Load(&m[(i + 8) % N])).Store(&actual[i]);
+    for (int i = 0; i < N; i++)
+        expected[i] = MultiplyScalar(m[i], m[(i + 8) % N]);
+    Report("Multiply wide8", (double)MaxUlps(expected.data(), actual.data(), N), 0.0, "ulps");
+
+    for (int i = 0; i < N; i++)
+    {
+        expected[i] = TransposeScalar(m[i]);
+        actual[i] = TransposeSimd(m[i]);
+    }
+    Report("Transpose simd", (double)MaxUlps(expected.data(), actual.data(), N), 0.0, "ulps");
+
+    for (int i = 0; i < N; i++)
+    {
+        expected[i] = InvertScalar(m[i]);
+        actual[i] = InvertSimd(m[i]);
+    }
+    Report("Invert scalar", MaxInverseError(m.data(), expected.data(), N), 1.0, "eps*cond");
+    Report("Invert simd", MaxInverseError(m.data(), actual.data(), N), 1.0, "eps*cond");
+
+    for (int i = 0; i < N; i += 8)
+        Invert(Matrixx8::Load(&m[i])).Store(&actual[i]);
+    Report("Invert wide8", (double)MaxUlps(expected.data(), actual.data(), N), 0.0, "ulps");
+}
+
+// Max errors against double precision libm, held to the bounds documented in MathSimd.h (not to this machine's results).
+// Rsqrt error repeats every two binades, so every float in [1, 4) is tested (bit patterns 0x3F800000 to 0x407FFFFF),
+// which covers all inputs short of denormals & infinities.
+void TestFunctions()
+{
+    const int count = 1 << 24;
+    std::vector<float> x(count), y(count), z(count);
+
+    for (int i = 0; i < count; i++)
+    {
+        uint32_t bits = 0x3F800000u + (uint32_t)i;
+        memcpy(&x[i], &bits, sizeof(float));
+    }
+
+    double rsqrtFast = 0.0, rsqrt = 0.0, sqrtFast = 0.0;
+    for (int i = 0; i < count; i += Float8::Width)
+    {
+        Float8 v = Float8::Load(&x[i]);
+        RsqrtFast(v).Store(&y[i]);
+        Rsqrt(v).Store(&z[i]);
+        for (int j = i; j < i + Float8::Width; j++)
+        {
+            double exact = 1.0 / sqrt((double)x[j]);
+            rsqrtFast = std::max(rsqrtFast, fabs(y[j] - exact) / exact);
+            rsqrt = std::max(rsqrt, fabs(z[j] - exact) / exact);
+        }
+
+        SqrtFast(v).Store(&y[i]);
+        for (int j = i; j < i + Float8::Width; j++)
+            sqrtFast = std::max(sqrtFast, fabs(y[j] - sqrt((double)x[j])) / sqrt((double)x[j]));
+    }
+
+    // Estimate bounds: Intel documents 1.5 * 2^-12 for rsqrtps (AMD's estimates differ but stay within it), ARM 2^-8 for
+    // vrsqrte. The scalar backend's exact 1 / sqrt(x) is rounded twice. One Newton-Raphson step leaves 1.5 e^2 for an
+    // estimate error e, plus its own roundings (2 eps), and SqrtFast's multiply adds one more rounding.
+#if defined(MATH_NEON)
+    const double estimate = 3.9e-3;
+#elif defined(MATH_SSE)
+    const double estimate = 3.7e-4;
+#else
+    const double estimate = 1.8e-7;
+#endif
+    const double refined = 1.5 * estimate * estimate + 2.0 * FLT_EPSILON;
+    Report("RsqrtFast", rsqrtFast, estimate, "relative");
+    Report("Rsqrt", rsqrt, refined, "relative");
+    Report("SqrtFast", sqrtFast, estimate + FLT_EPSILON, "relative");
+
+    // Evenly spaced over |x| <= 8192
+    for (int i = 0; i < count; i++)
+        x[i] = -8192.0f + 16384.0f * (float)i / (count - 1);
+    SinCos(x.data(), y.data(), z.data(), count);
+
+    double sine = 0.0, cosine = 0.0;
+    for (int i = 0; i < count; i++)
+    {
+        sine = std::max(sine, fabs(y[i] - sin((double)x[i])));
+        cosine = std::max(cosine, fabs(z[i] - cos((double)x[i])));
+    }
+    // Results are at most 1 in magnitude, so 2 ulps at 1.0 covers the result rounding (0.5 ulp) plus the Cephes polynomials'
+    // and the Cody-Waite reduction's error with room for FMA contraction or other input sets (about 9.3e-8 measured)
+    Report("SinCos sin", sine, 2.0 * FLT_EPSILON, "absolute");
+    Report("SinCos cos", cosine, 2.0 * FLT_EPSILON, "absolute");
+
+    // Random directions scaled to lengths from 1e-3 to 1e3, plus zero vectors which must come back unchanged
+    std::vector<Vector3> vectors(N), normalized(N);
+    std::vector<float> lengths(N);
+    RandomFill(3, &vectors[0].x, N * 3, -1.0f, 1.0f);
+    RandomFill(4, lengths.data(), N, -3.0f, 3.0f);
+    for (int i = 0; i < N; i++)
+        vectors[i] = (i % 64 == 0) ? Vector3{ 0.0f, 0.0f, 0.0f } : vectors[i] * powf(10.0f, lengths[i]);
+    Normalize(vectors.data(), normalized.data(), N);
+
+    double normalize = 0.0;
+    for (int i = 0; i < N; i++)
+    {
+        const Vector3& v = vectors[i];
+        double length = sqrt((double)v.x * v.x + (double)v.y * v.y + (double)v.z * v.z);
+        double scale = length > 0.0 ? 1.0 / length : 1.0;
+        normalize = std::max(normalize, fabs(normalized[i].x - v.x * scale));
+        normalize = std::max(normalize, fabs(normalized[i].y - v.y * scale));
+        normalize = std::max(normalize, fabs(normalized[i].z - v.z * scale));
+    }
+    // Rsqrt's bound plus the roundings of the length & the final multiply
+    Report("Normalize batched", normalize, refined + 2.0 * FLT_EPSILON, "absolute");
+}
+
+int main()
+{
+    printf("Math tests (%s backend)\n", BackendName());
+    std::vector<Matrix> matrices = CreateMatrices();
+    TestMatrices(matrices);
+    TestFunctions();
+
+    if (g_failures > 0)
+        printf("%d test(s) failed\n", g_failures);
+    return g_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,62 @@
+// Offline mesh cooker. GPU-free: cooks the same <path>.mesh caches LoadMesh would write on first load.
+//
+// Usage: MeshCook [--force] <obj path>...
+// Cooks every obj whose cache is missing or stale (all of them with --force), so shipped builds never parse obj files.
+// Exits with 1 if any obj can't be read or its cache can't be written.
+
+#include "Mesh.h"
+#include "MeshCache.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+int main(int argc, char** argv)
+{
+    bool force = false;
+    int cooked = 0, current = 0, failures = 0;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--force") == 0)
+        {
+            force = true;
+            continue;
+        }
+
+        const char* path = argv[i];
+        FILE* file = fopen(path, "rb");
+        if (file == nullptr)
+        {
+            printf("**Error: could not read %s**\n", path);
+            failures++;
+            continue;
+        }
+        fclose(file);
+
+        Mesh mesh;
+        if (!force && LoadMeshCache(&mesh, path))
+        {
+            current++;
+            continue;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        if (CookMesh(&mesh, path))
+        {
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            printf("Cooked %s in %.1f ms\n", path, ms);
+            cooked++;
+        }
+        else
+            failures++;
+    }
+
+    if (cooked + current + failures == 0)
+    {
+        printf("Usage: MeshCook [--force] <obj path>...\n");
+        return 1;
+    }
+
+    printf("%d cooked, %d already current, %d failed\n", cooked, current, failures);
+    return failures == 0 ? 0 : 1;
+}
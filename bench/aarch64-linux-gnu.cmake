@@ -0,0 +1,14 @@
+# Cross build of the bench for arm64 (NEON backend), tests run through user-mode QEMU:
+#   cmake -S bench -B build-bench-arm64 -DCMAKE_TOOLCHAIN_FILE=bench/aarch64-linux-gnu.cmake
+#   cmake --build build-bench-arm64 && ctest --test-dir build-bench-arm64
+# Needs g++-aarch64-linux-gnu & qemu-user (Debian/Ubuntu package names).
+set(CMAKE_SYSTEM_NAME Linux)
+set(CMAKE_SYSTEM_PROCESSOR aarch64)
+
+set(CMAKE_C_COMPILER aarch64-linux-gnu-gcc)
+set(CMAKE_CXX_COMPILER aarch64-linux-gnu-g++)
+set(CMAKE_CROSSCOMPILING_EMULATOR qemu-aarch64 -L /usr/aarch64-linux-gnu)
+
+set(CMAKE_FIND_ROOT_PATH_MODE_PROGRAM NEVER)
+set(CMAKE_FIND_ROOT_PATH_MODE_LIBRARY ONLY)
+set(CMAKE_FIND_ROOT_PATH_MODE_INCLUDE ONLY)
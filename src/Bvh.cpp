@@ -0,0 +1,562 @@
+#include "Bvh.h"
+#include "Mesh.h"
+#include "MathSimd.h"
+#include <algorithm>
+#include <cassert>
+
+// SAH bins per axis & the largest leaf. Leaves may hold fewer primitives whenever splitting is cheaper.
+static const int BVH_BINS = 16;
+static const int BVH_MAX_LEAF = 8;
+
+// Subtrees handed to worker threads never get smaller than this, so tiny builds stay on one thread
+static const int BVH_PARALLEL_MIN = 4096;
+
+// Traversal stack depth, which bounds the tree's depth. Past BVH_MAX_DEPTH nodes are split at the median instead of
+// by SAH, which adds at most 31 more levels for any int primitive count, so no traversal holds more than 64 entries.
+static const int BVH_STACK = 64;
+static const int BVH_MAX_DEPTH = BVH_STACK - 32;
+
+// Primitive bounds the builder works on: triangles for mesh BVHs, instance boxes for instance BVHs
+struct BuildInput
+{
+	std::vector<Vector3> mins;
+	std::vector<Vector3> maxs;
+	std::vector<Vector3> centroids;
+	std::vector<int> order;	// Primitives, partitioned in place as nodes split
+};
+
+struct BuildTask
+{
+	int node;
+	int begin;
+	int end;
+	int depth;
+};
+
+static float SurfaceArea(Vector3 min, Vector3 max)
+{
+	Vector3 size = max - min;
+	return size.x * size.y + size.y * size.z + size.z * size.x;
+}
+
+// std::min rather than Min: no NaNs reach the builder, and fminf can be a library call in these hot loops
+static void Grow(Vector3* min, Vector3* max, Vector3 pMin, Vector3 pMax)
+{
+	*min = { std::min(min->x, pMin.x), std::min(min->y, pMin.y), std::min(min->z, pMin.z) };
+	*max = { std::max(max->x, pMax.x), std::max(max->y, pMax.y), std::max(max->z, pMax.z) };
+}
+
+// Splits the node covering order[begin, end), at the given depth, recursively. Nodes with at most deferBelow primitives
+// are left as placeholder leaves in deferred (when given) so their subtrees can be built on other threads.
+static void Subdivide(BuildInput& input, std::vector<BvhNode>& nodes, int index, int begin, int end, int depth,
+	int deferBelow, std::vector<BuildTask>* deferred)
+{
+	const int* order = input.order.data();
+	Vector3 min = { FLT_MAX, FLT_MAX, FLT_MAX }, max = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+	Vector3 centroidMin = min, centroidMax = max;
+	for (int i = begin; i < end; i++)
+	{
+		int p = order[i];
+		Grow(&min, &max, input.mins[p], input.maxs[p]);
+		Grow(&centroidMin, &centroidMax, input.centroids[p], input.centroids[p]);
+	}
+
+	int count = end - begin;
+	nodes[index] = { min, begin, max, count };
+	if (deferred != nullptr && count <= deferBelow)
+	{
+		deferred->push_back({ index, begin, end, depth });
+		return;
+	}
+	if (count <= 2)
+		return;
+
+	// Sweep the bins of every axis from both sides to find the cheapest split plane
+	int bestAxis = -1, bestSplit = 0;
+	float bestCost = FLT_MAX;
+	for (int axis = 0; axis < 3 && depth < BVH_MAX_DEPTH; axis++)
+	{
+		float lo = (&centroidMin.x)[axis], hi = (&centroidMax.x)[axis];
+		if (hi <= lo)
+			continue;
+
+		int binCounts[BVH_BINS] = {};
+		Vector3 binMins[BVH_BINS], binMaxs[BVH_BINS];
+		for (int b = 0; b < BVH_BINS; b++)
+		{
+			binMins[b] = { FLT_MAX, FLT_MAX, FLT_MAX };
+			binMaxs[b] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+		}
+
+		float scale = BVH_BINS / (hi - lo);
+		for (int i = begin; i < end; i++)
+		{
+			int p = order[i];
+			int b = std::min((int)(((&input.centroids[p].x)[axis] - lo) * scale), BVH_BINS - 1);
+			binCounts[b]++;
+			Grow(&binMins[b], &binMaxs[b], input.mins[p], input.maxs[p]);
+		}
+
+		float rightCosts[BVH_BINS];
+		Vector3 sweepMin = { FLT_MAX, FLT_MAX, FLT_MAX }, sweepMax = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+		int sweepCount = 0;
+		for (int b = BVH_BINS - 1; b > 0; b--)
+		{
+			sweepCount += binCounts[b];
+			if (binCounts[b] > 0)
+				Grow(&sweepMin, &sweepMax, binMins[b], binMaxs[b]);
+			rightCosts[b] = sweepCount > 0 ? sweepCount * SurfaceArea(sweepMin, sweepMax) : 0.0f;
+		}
+
+		sweepMin = { FLT_MAX, FLT_MAX, FLT_MAX };
+		sweepMax = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+		sweepCount = 0;
+		for (int b = 0; b < BVH_BINS - 1; b++)
+		{
+			sweepCount += binCounts[b];
+			if (binCounts[b] > 0)
+				Grow(&sweepMin, &sweepMax, binMins[b], binMaxs[b]);
+
+			if (sweepCount == 0 || sweepCount == count)
+				continue;
+			float cost = sweepCount * SurfaceArea(sweepMin, sweepMax) + rightCosts[b + 1];
+			if (cost < bestCost)
+			{
+				bestCost = cost;
+				bestAxis = axis;
+				bestSplit = b + 1;
+			}
+		}
+	}
+
+	// Costs are relative to one intersection test, with a node visit costing about as much
+	float leafCost = count * SurfaceArea(min, max);
+	float splitCost = SurfaceArea(min, max) + bestCost;
+	if (count <= BVH_MAX_LEAF && (bestAxis < 0 || leafCost <= splitCost))
+		return;
+
+	int middle;
+	if (bestAxis >= 0)
+	{
+		float lo = (&centroidMin.x)[bestAxis];
+		float scale = BVH_BINS / ((&centroidMax.x)[bestAxis] - lo);
+		middle = (int)(std::partition(input.order.begin() + begin, input.order.begin() + end, [&](int p)
+		{
+			return std::min((int)(((&input.centroids[p].x)[bestAxis] - lo) * scale), BVH_BINS - 1) < bestSplit;
+		}) - input.order.begin());
+	}
+	else
+	{
+		// Median along the widest centroid axis: past BVH_MAX_DEPTH, or when every centroid is the same point.
+		// Halving the count each level is what bounds the depth.
+		Vector3 extent = centroidMax - centroidMin;
+		int axis = extent.x >= extent.y && extent.x >= extent.z ? 0 : (extent.y >= extent.z ? 1 : 2);
+		middle = begin + count / 2;
+		std::nth_element(input.order.begin() + begin, input.order.begin() + middle, input.order.begin() + end, [&](int a, int b)
+		{
+			return (&input.centroids[a].x)[axis] < (&input.centroids[b].x)[axis];
+		});
+	}
+
+	int left = (int)nodes.size();
+	nodes.resize(nodes.size() + 2);
+	nodes[index].first = left;
+	nodes[index].count = 0;
+	Subdivide(input, nodes, left, begin, middle, depth + 1, deferBelow, deferred);
+	Subdivide(input, nodes, left + 1, middle, end, depth + 1, deferBelow, deferred);
+}
+
+static void Build(BuildInput& input, std::vector<BvhNode>* nodes, bool parallel)
+{
+	int count = (int)input.order.size();
+	nodes->clear();
+	if (count == 0)
+		return;
+
+	nodes->reserve(2 * count);
+	nodes->resize(1);
+	int workers = (int)std::thread::hardware_concurrency();
+	if (!parallel || workers <= 1 || count < 2 * BVH_PARALLEL_MIN)
+	{
+		Subdivide(input, *nodes, 0, 0, count, 0, 0, nullptr);
+		return;
+	}
+
+	// Several subtrees per worker keeps the threads busy when the tree is unbalanced
+	std::vector<BuildTask> tasks;
+	int deferBelow = std::max(count / (4 * workers), BVH_PARALLEL_MIN);
+	Subdivide(input, *nodes, 0, 0, count, 0, deferBelow, &tasks);
+
+	std::vector<std::vector<BvhNode>> subtrees(tasks.size());
+	ParallelFor((int)tasks.size(), 1, [&](int first, int last)
+	{
+		for (int t = first; t < last; t++)
+		{
+			subtrees[t].resize(1);
+			Subdivide(input, subtrees[t], 0, tasks[t].begin, tasks[t].end, tasks[t].depth, 0, nullptr);
+		}
+	});
+
+	// Local node 0 replaces the placeholder, the rest are appended & their child links rebased
+	for (size_t t = 0; t < tasks.size(); t++)
+	{
+		const std::vector<BvhNode>& subtree = subtrees[t];
+		int base = (int)nodes->size() - 1;
+		for (size_t i = 0; i < subtree.size(); i++)
+		{
+			BvhNode node = subtree[i];
+			if (node.count == 0)
+				node.first += base;
+			if (i == 0)
+				(*nodes)[tasks[t].node] = node;
+			else
+				nodes->push_back(node);
+		}
+	}
+}
+
+void BuildBvh(MeshBvh* bvh, const Vector3* positions, const uint32_t* indices, int count, bool parallel)
+{
+	int triangleCount = count / 3;
+	BuildInput input;
+	input.mins.resize(triangleCount);
+	input.maxs.resize(triangleCount);
+	input.centroids.resize(triangleCount);
+	input.order.resize(triangleCount);
+	for (int t = 0; t < triangleCount; t++)
+	{
+		Vector3 a = positions[indices[t * 3]], b = positions[indices[t * 3 + 1]], c = positions[indices[t * 3 + 2]];
+		input.mins[t] = { std::min(a.x, std::min(b.x, c.x)), std::min(a.y, std::min(b.y, c.y)), std::min(a.z, std::min(b.z, c.z)) };
+		input.maxs[t] = { std::max(a.x, std::max(b.x, c.x)), std::max(a.y, std::max(b.y, c.y)), std::max(a.z, std::max(b.z, c.z)) };
+		input.centroids[t] = (input.mins[t] + input.maxs[t]) * 0.5f;
+		input.order[t] = t;
+	}
+
+	Build(input, &bvh->nodes, parallel);
+
+	bvh->triangles = input.order;
+	bvh->corners.resize(triangleCount * 3);
+	for (int i = 0; i < triangleCount; i++)
+	{
+		int t = input.order[i];
+		for (int k = 0; k < 3; k++)
+			bvh->corners[i * 3 + k] = positions[indices[t * 3 + k]];
+	}
+}
+
+void BuildBvh(MeshBvh* bvh, const Mesh& mesh, bool parallel)
+{
+	assert(mesh.ranges.empty(), "Build the BVH before splitting into 16-bit ranges");
+	BuildBvh(bvh, mesh.positions.data(), mesh.indices.data(), (int)mesh.indices.size(), parallel);
+}
+
+void BuildBvh(InstanceBvh* bvh, const MeshBvh* const* meshes, const Matrix* worlds, int count)
+{
+	BuildInput input;
+	input.mins.resize(count);
+	input.maxs.resize(count);
+	input.centroids.resize(count);
+	input.order.resize(count);
+	bvh->inverseWorlds.resize(count);
+	bvh->meshes.assign(meshes, meshes + count);
+	for (int i = 0; i < count; i++)
+	{
+		// Empty meshes get an inverted box, which no ray enters
+		const BvhNode* root = meshes[i]->nodes.empty() ? nullptr : &meshes[i]->nodes[0];
+		if (root != nullptr)
+			TransformAabb(worlds[i], root->min, root->max, &input.mins[i], &input.maxs[i]);
+		else
+		{
+			input.mins[i] = { FLT_MAX, FLT_MAX, FLT_MAX };
+			input.maxs[i] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+		}
+		input.centroids[i] = root != nullptr ? (input.mins[i] + input.maxs[i]) * 0.5f : V3_ZERO;
+		input.order[i] = i;
+		bvh->inverseWorlds[i] = Invert(worlds[i]);
+	}
+
+	Build(input, &bvh->nodes, false);
+	bvh->instances = input.order;
+}
+
+//----------------------------------------------------------------------------------
+// Single ray traversal
+//----------------------------------------------------------------------------------
+
+// 1 / x without infinities, so 0 * inf never turns a slab test into NaN
+static inline float SafeInverse(float x)
+{
+	const float tiny = 1e-30f;
+	return 1.0f / (Abs(x) > tiny ? x : (x < 0.0f ? -tiny : tiny));
+}
+
+// Entry distance into the box, or FLT_MAX if the ray misses it or only enters beyond maxT
+static inline float SlabTest(const BvhNode& node, Vector3 origin, Vector3 inverse, float maxT)
+{
+	float tx0 = (node.min.x - origin.x) * inverse.x, tx1 = (node.max.x - origin.x) * inverse.x;
+	float ty0 = (node.min.y - origin.y) * inverse.y, ty1 = (node.max.y - origin.y) * inverse.y;
+	float tz0 = (node.min.z - origin.z) * inverse.z, tz1 = (node.max.z - origin.z) * inverse.z;
+	float tNear = std::max(std::max(std::min(tx0, tx1), std::min(ty0, ty1)), std::max(std::min(tz0, tz1), 0.0f));
+	float tFar = std::min(std::min(std::max(tx0, tx1), std::max(ty0, ty1)), std::max(tz0, tz1));
+	return tNear <= tFar && tNear < maxT ? tNear : FLT_MAX;
+}
+
+// Two-sided Moller-Trumbore
+static inline bool IntersectTriangle(const Ray& ray, const Vector3* corners, float* t, float* u, float* v)
+{
+	Vector3 e1 = corners[1] - corners[0];
+	Vector3 e2 = corners[2] - corners[0];
+	Vector3 p = Cross(ray.direction, e2);
+	float det = Dot(e1, p);
+	if (det == 0.0f)
+		return false;
+
+	float inverse = 1.0f / det;
+	Vector3 s = ray.origin - corners[0];
+	*u = Dot(s, p) * inverse;
+	if (*u < 0.0f || *u > 1.0f)
+		return false;
+
+	Vector3 q = Cross(s, e1);
+	*v = Dot(ray.direction, q) * inverse;
+	if (*v < 0.0f || *u + *v > 1.0f)
+		return false;
+
+	*t = Dot(e2, q) * inverse;
+	return *t > 0.0f;
+}
+
+bool Intersect(const MeshBvh& bvh, const Ray& ray, RayHit* hit)
+{
+	if (bvh.nodes.empty())
+		return false;
+
+	Vector3 inverse = { SafeInverse(ray.direction.x), SafeInverse(ray.direction.y), SafeInverse(ray.direction.z) };
+	if (SlabTest(bvh.nodes[0], ray.origin, inverse, hit->t) == FLT_MAX)
+		return false;
+
+	bool found = false;
+	int stack[BVH_STACK];
+	int top = 0;
+	int index = 0;
+	for (;;)
+	{
+		const BvhNode& node = bvh.nodes[index];
+		if (node.count > 0)
+		{
+			for (int i = node.first; i < node.first + node.count; i++)
+			{
+				float t, u, v;
+				if (IntersectTriangle(ray, &bvh.corners[i * 3], &t, &u, &v) && t < hit->t)
+				{
+					*hit = { t, bvh.triangles[i], hit->instance, u, v };
+					found = true;
+				}
+			}
+		}
+		else
+		{
+			// Visit the nearer child first so the farther one is often culled by the hit found in it
+			int near = node.first, far = node.first + 1;
+			float tNear = SlabTest(bvh.nodes[near], ray.origin, inverse, hit->t);
+			float tFar = SlabTest(bvh.nodes[far], ray.origin, inverse, hit->t);
+			if (tFar < tNear)
+			{
+				std::swap(near, far);
+				std::swap(tNear, tFar);
+			}
+
+			if (tNear != FLT_MAX)
+			{
+				if (tFar != FLT_MAX)
+				{
+					assert(top < BVH_STACK, "BVH traversal stack overflow");
+					stack[top++] = far;
+				}
+				index = near;
+				continue;
+			}
+		}
+
+		// Nodes popped here may have been passed before a closer hit shrank hit->t, so retest them
+		bool next = false;
+		while (top > 0 && !next)
+		{
+			index = stack[--top];
+			next = SlabTest(bvh.nodes[index], ray.origin, inverse, hit->t) != FLT_MAX;
+		}
+		if (!next)
+			break;
+	}
+	return found;
+}
+
+bool Intersect(const InstanceBvh& bvh, const Ray& ray, RayHit* hit)
+{
+	if (bvh.nodes.empty())
+		return false;
+
+	Vector3 inverse = { SafeInverse(ray.direction.x), SafeInverse(ray.direction.y), SafeInverse(ray.direction.z) };
+	bool found = false;
+	int stack[BVH_STACK];
+	int top = 0;
+	stack[top++] = 0;
+	while (top > 0)
+	{
+		const BvhNode& node = bvh.nodes[stack[--top]];
+		if (SlabTest(node, ray.origin, inverse, hit->t) == FLT_MAX)
+			continue;
+
+		if (node.count == 0)
+		{
+			assert(top + 2 <= BVH_STACK, "BVH traversal stack overflow");
+			stack[top++] = node.first + 1;
+			stack[top++] = node.first;
+			continue;
+		}
+
+		for (int i = node.first; i < node.first + node.count; i++)
+		{
+			// The direction isn't renormalized, so distances in the mesh's space equal world distances
+			int instance = bvh.instances[i];
+			const Matrix& inverseWorld = bvh.inverseWorlds[instance];
+			Vector3 d = ray.direction;
+			Ray local;
+			local.origin = Multiply(ray.origin, inverseWorld);
+			local.direction = {
+				inverseWorld.m0 * d.x + inverseWorld.m4 * d.y + inverseWorld.m8 * d.z,
+				inverseWorld.m1 * d.x + inverseWorld.m5 * d.y + inverseWorld.m9 * d.z,
+				inverseWorld.m2 * d.x + inverseWorld.m6 * d.y + inverseWorld.m10 * d.z
+			};
+
+			if (Intersect(*bvh.meshes[instance], local, hit))
+			{
+				hit->instance = instance;
+				found = true;
+			}
+		}
+	}
+	return found;
+}
+
+//----------------------------------------------------------------------------------
+// Packet traversal
+//----------------------------------------------------------------------------------
+
+struct RayPacket
+{
+	Vector3x8 origin;
+	Vector3x8 direction;
+	Vector3x8 inverse;
+	Float8 t;	// Closest hit so far per lane, -1 for unused lanes so they never enter a node
+};
+
+// Lanes whose ray enters the node before its current closest hit
+static inline int SlabTest(const BvhNode& node, const RayPacket& packet)
+{
+	Float8 tx0 = (Float8::Set(node.min.x) - packet.origin.x) * packet.inverse.x;
+	Float8 tx1 = (Float8::Set(node.max.x) - packet.origin.x) * packet.inverse.x;
+	Float8 ty0 = (Float8::Set(node.min.y) - packet.origin.y) * packet.inverse.y;
+	Float8 ty1 = (Float8::Set(node.max.y) - packet.origin.y) * packet.inverse.y;
+	Float8 tz0 = (Float8::Set(node.min.z) - packet.origin.z) * packet.inverse.z;
+	Float8 tz1 = (Float8::Set(node.max.z) - packet.origin.z) * packet.inverse.z;
+	Float8 tNear = Max(Max(Min(tx0, tx1), Min(ty0, ty1)), Max(Min(tz0, tz1), Float8::Set(0.0f)));
+	Float8 tFar = Min(Min(Max(tx0, tx1), Max(ty0, ty1)), Max(tz0, tz1));
+	return MoveMask((tNear <= tFar) & (tNear < packet.t));
+}
+
+void IntersectPacket(const MeshBvh& bvh, const Ray* rays, RayHit* hits, int count)
+{
+	if (bvh.nodes.empty())
+		return;
+
+	for (int first = 0; first < count; first += Float8::Width)
+	{
+		int lanes = std::min(count - first, (int)Float8::Width);
+		Vector3 origins[Float8::Width], directions[Float8::Width], inverses[Float8::Width];
+		float ts[Float8::Width];
+		for (int lane = 0; lane < Float8::Width; lane++)
+		{
+			const Ray& ray = rays[first + std::min(lane, lanes - 1)];
+			origins[lane] = ray.origin;
+			directions[lane] = ray.direction;
+			inverses[lane] = { SafeInverse(ray.direction.x), SafeInverse(ray.direction.y), SafeInverse(ray.direction.z) };
+			ts[lane] = lane < lanes ? hits[first + lane].t : -1.0f;
+		}
+
+		RayPacket packet;
+		packet.origin = Vector3x8::Load(origins);
+		packet.direction = Vector3x8::Load(directions);
+		packet.inverse = Vector3x8::Load(inverses);
+		packet.t = Float8::Load(ts);
+		Float8 us = Float8::Set(0.0f), vs = Float8::Set(0.0f);
+		int triangles[Float8::Width];
+		for (int lane = 0; lane < Float8::Width; lane++)
+			triangles[lane] = -1;
+
+		int stack[BVH_STACK];
+		int top = 0;
+		stack[top++] = 0;
+		while (top > 0)
+		{
+			const BvhNode& node = bvh.nodes[stack[--top]];
+			if (SlabTest(node, packet) == 0)
+				continue;
+
+			if (node.count == 0)
+			{
+				// Order children by the first ray's direction, which is close enough for coherent packets
+				const BvhNode& left = bvh.nodes[node.first];
+				const BvhNode& right = bvh.nodes[node.first + 1];
+				Vector3 offset = (right.min + right.max) - (left.min + left.max);
+				bool rightFirst = Dot(offset, directions[0]) < 0.0f;
+				assert(top + 2 <= BVH_STACK, "BVH traversal stack overflow");
+				stack[top++] = rightFirst ? node.first : node.first + 1;
+				stack[top++] = rightFirst ? node.first + 1 : node.first;
+				continue;
+			}
+
+			for (int i = node.first; i < node.first + node.count; i++)
+			{
+				// Same operations as IntersectTriangle, one triangle against every lane
+				const Vector3* corners = &bvh.corners[i * 3];
+				Vector3x8 e1 = Vector3x8::Set(corners[1] - corners[0]);
+				Vector3x8 e2 = Vector3x8::Set(corners[2] - corners[0]);
+				Vector3x8 p = Cross(packet.direction, e2);
+				Float8 det = Dot(e1, p);
+				Float8 inverse = Float8::Set(1.0f) / det;
+				Vector3x8 s = packet.origin - Vector3x8::Set(corners[0]);
+				Float8 u = Dot(s, p) * inverse;
+				Vector3x8 q = Cross(s, e1);
+				Float8 v = Dot(packet.direction, q) * inverse;
+				Float8 t = Dot(e2, q) * inverse;
+
+				Float8 zero = Float8::Set(0.0f), one = Float8::Set(1.0f);
+				Float8 mask = ((det < zero) | (det > zero)) & (u >= zero) & (u <= one) & (v >= zero) & (u + v <= one) &
+					(t > zero) & (t < packet.t);
+				int bits = MoveMask(mask);
+				if (bits == 0)
+					continue;
+
+				packet.t = Select(mask, t, packet.t);
+				us = Select(mask, u, us);
+				vs = Select(mask, v, vs);
+				for (int lane = 0; lane < Float8::Width; lane++)
+				{
+					if (bits & (1 << lane))
+						triangles[lane] = bvh.triangles[i];
+				}
+			}
+		}
+
+		float u[Float8::Width], v[Float8::Width];
+		packet.t.Store(ts);
+		us.Store(u);
+		vs.Store(v);
+		for (int lane = 0; lane < lanes; lane++)
+		{
+			if (triangles[lane] >= 0)
+				hits[first + lane] = { ts[lane], triangles[lane], hits[first + lane].instance, u[lane], v[lane] };
+		}
+	}
+}
@@ -0,0 +1,64 @@
+#pragma once
+#include <cfloat>
+#include <cstdint>
+#include <vector>
+#include "Math.h"
+
+struct Mesh;
+
+struct Ray
+{
+	Vector3 origin;
+	Vector3 direction;	// Needn't be normalized, hit distances are in multiples of its length
+};
+
+struct RayHit
+{
+	float t = FLT_MAX;	// Distance along the ray. Only hits closer than this are reported.
+	int triangle = -1;	// Hit triangle, ie indices[triangle * 3] onwards
+	int instance = -1;	// Hit instance (InstanceBvh queries only)
+	float u = 0.0f;		// Barycentric weights of the triangle's 2nd & 3rd corners
+	float v = 0.0f;
+};
+
+// 32 bytes so two nodes share a cache line. Siblings are always adjacent, so one index reaches both.
+struct BvhNode
+{
+	Vector3 min;
+	int first;	// Leaf: first primitive. Inner: left child, the right child follows it.
+	Vector3 max;
+	int count;	// Primitives in a leaf, 0 for inner nodes
+};
+
+// Bottom level: triangles of one mesh in object space
+struct MeshBvh
+{
+	std::vector<BvhNode> nodes;	// nodes[0] is the root
+	std::vector<Vector3> corners;	// 3 corners per triangle in leaf order, so a leaf reads one contiguous block
+	std::vector<int> triangles;	// Mesh triangle of each leaf triangle
+};
+
+// Top level: instances of bottom level BVHs placed by world matrices
+struct InstanceBvh
+{
+	std::vector<BvhNode> nodes;
+	std::vector<int> instances;	// Instance of each leaf primitive
+	std::vector<Matrix> inverseWorlds;	// Per instance, maps world-space rays into the mesh's space
+	std::vector<const MeshBvh*> meshes;	// Per instance
+};
+
+// Binned SAH build (Wald 2007). The top levels are split on the calling thread, then the subtrees below them
+// are built in parallel and spliced into one depth-first node array.
+void BuildBvh(MeshBvh* bvh, const Vector3* positions, const uint32_t* indices, int count, bool parallel = true);
+void BuildBvh(MeshBvh* bvh, const Mesh& mesh, bool parallel = true);
+
+// meshes & worlds hold one entry per instance, and the meshes must outlive the instance BVH
+void BuildBvh(InstanceBvh* bvh, const MeshBvh* const* meshes, const Matrix* worlds, int count);
+
+// Closest hit nearer than hit->t. Returns whether hit was updated.
+bool Intersect(const MeshBvh& bvh, const Ray& ray, RayHit* hit);
+bool Intersect(const InstanceBvh& bvh, const Ray& ray, RayHit* hit);
+
+// Traces rays 8 at a time: every node & triangle is tested against the whole packet with Float8 lanes,
+// so coherent rays (ie neighbouring pixels) share one traversal. Same results as Intersect per ray.
+void IntersectPacket(const MeshBvh& bvh, const Ray* rays, RayHit* hits, int count);
@@ -0,0 +1,94 @@
+#include "DrawBatch.h"
+#include "GeometryArena.h"
+#include "Mesh.h"
+#include "RingBuffer.h"
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+
+// GL caps uniform & storage buffer offset alignments at 256, so no ring pads an allocation by more than this
+constexpr size_t MAX_RING_PADDING = 256;
+
+void CreateBatch(DrawBatch* batch, const GeometryArena* arena, RingBuffer* ring, int capacity)
+{
+	batch->arena = arena;
+	batch->ring = ring;
+	batch->commands.reserve(capacity);
+	batch->draws.reserve(capacity);
+}
+
+void DestroyBatch(DrawBatch* batch)
+{
+	*batch = {};
+}
+
+size_t BatchRingSize(int count)
+{
+	// Commands need at most 3 bytes of padding, the draw data at most the ring's alignment
+	return count * (sizeof(DrawElementsIndirectCommand) + sizeof(DrawData)) + sizeof(uint32_t) + MAX_RING_PADDING;
+}
+
+void AddDraw(DrawBatch* batch, const Mesh& mesh, Matrix world, int lod)
+{
+	assert(mesh.arena == batch->arena, "Batched meshes must be in the batch's arena");
+	if (batch->arena->layout == LAYOUT_QUANTIZED)
+		world = mesh.dequantize * world;
+
+	if (!mesh.ranges.empty())
+	{
+		for (const MeshRange& range : mesh.ranges)
+		{
+			batch->commands.push_back({ (uint32_t)range.count, 1, (uint32_t)(mesh.indexBlock.offset + range.offset),
+				mesh.vertexBlock.offset + range.baseVertex, 0 });
+			batch->draws.push_back({ world });
+		}
+		return;
+	}
+
+	int first, count;
+	GetLodRange(mesh, lod, &first, &count);
+	batch->commands.push_back({ (uint32_t)count, 1, (uint32_t)first, mesh.vertexBlock.offset, 0 });
+	batch->draws.push_back({ world });
+}
+
+void SubmitBatch(DrawBatch* batch)
+{
+	int count = (int)batch->commands.size();
+	if (count == 0)
+		return;
+
+	// Submit what the region can still hold, worst case padding included, rather than failing the whole batch
+	RingBuffer* ring = batch->ring;
+	size_t available = RingAvailable(ring, sizeof(uint32_t));
+	size_t padding = sizeof(uint32_t) + ring->alignment;
+	int fit = available > padding ? (int)((available - padding) / (sizeof(DrawElementsIndirectCommand) + sizeof(DrawData))) : 0;
+	if (fit < count)
+	{
+		if (!batch->overflowed)
+			printf("**Warning: ring region is full, dropped %d of %d batched draws (it needs %zu bytes, raise frameSize)**\n",
+				count - fit, count, BatchRingSize(count));
+		batch->overflowed = true;
+		count = fit;
+	}
+	if (count == 0)
+	{
+		batch->commands.clear();
+		batch->draws.clear();
+		return;
+	}
+
+	// Indirect commands only need 4-byte alignment, the draw data is bound as a storage buffer
+	RingAllocation commands = RingAllocate(ring, count * sizeof(DrawElementsIndirectCommand), sizeof(uint32_t));
+	RingAllocation draws = RingAllocate(ring, count * sizeof(DrawData));
+	memcpy(commands.data, batch->commands.data(), commands.size);
+	memcpy(draws.data, batch->draws.data(), draws.size);
+
+	BindVertexArray(batch->arena->vao);
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, commands.buffer);
+	glBindBufferRange(GL_SHADER_STORAGE_BUFFER, DRAW_DATA_BINDING, draws.buffer, draws.offset, draws.size);
+	glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, (const void*)commands.offset, count, 0);
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, GL_NONE);
+
+	batch->commands.clear();
+	batch->draws.clear();
+}
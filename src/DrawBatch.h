@@ -0,0 +1,51 @@
+#pragma once
+#include <glad/glad.h>
+#include <cstdint>
+#include <vector>
+#include "Math.h"
+
+struct Mesh;
+struct GeometryArena;
+struct RingBuffer;
+
+// Layout glMultiDrawElementsIndirect reads from the draw indirect buffer
+struct DrawElementsIndirectCommand
+{
+	uint32_t count;
+	uint32_t instanceCount;
+	uint32_t firstIndex;
+	int32_t baseVertex;
+	uint32_t baseInstance;
+};
+
+// Per-draw data, read by batched shaders as draws[gl_DrawID] from a std430, row_major buffer at DRAW_DATA_BINDING (see asteroids.vert)
+struct DrawData
+{
+	Matrix world;	// From the vertices as stored, so for quantized arenas it starts with the mesh's dequantize
+};
+
+constexpr GLuint DRAW_DATA_BINDING = 0;
+
+// Draws of meshes from one arena that share a shader. Every draw gets its own command & DrawData,
+// and SubmitBatch issues them all with one glMultiDrawElementsIndirect, so the CPU cost no longer scales with draws.
+struct DrawBatch
+{
+	const GeometryArena* arena = nullptr;
+	RingBuffer* ring = nullptr;	// Commands & draw data are streamed through the current frame's region
+	std::vector<DrawElementsIndirectCommand> commands;
+	std::vector<DrawData> draws;
+	bool overflowed = false;	// Set once a submit didn't fit the ring, so its warning prints once rather than every frame
+};
+
+void CreateBatch(DrawBatch* batch, const GeometryArena* arena, RingBuffer* ring, int capacity = 1024);
+void DestroyBatch(DrawBatch* batch);
+
+// Ring bytes a submit of count commands can take, alignment padding included. Size the ring's frameSize to cover every batch.
+size_t BatchRingSize(int count);
+
+// Queues the mesh (which must be in the batch's arena) at the given LOD. Split meshes queue one command per range.
+void AddDraw(DrawBatch* batch, const Mesh& mesh, Matrix world, int lod = 0);
+
+// Writes the queued commands & draw data to the ring, draws them with the current program, then empties the batch.
+// If the ring's region can't hold them all, the draws that fit are submitted and the rest are dropped with a warning.
+void SubmitBatch(DrawBatch* batch);
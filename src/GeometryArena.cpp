@@ -0,0 +1,254 @@
+#include "GeometryArena.h"
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+
+// Buffers are immutable storage updated in place, and everything uses DSA so arena updates never disturb the bound VAO
+static GLuint CreateBuffer(size_t bytes)
+{
+	GLuint buffer = GL_NONE;
+	glCreateBuffers(1, &buffer);
+	glNamedBufferStorage(buffer, bytes, nullptr, GL_DYNAMIC_STORAGE_BIT);
+	return buffer;
+}
+
+static void AttachBuffers(GeometryArena* arena)
+{
+	glVertexArrayVertexBuffer(arena->vao, 0, arena->vbo, 0, (GLsizei)arena->vertexSize);
+	glVertexArrayElementBuffer(arena->vao, arena->ebo);
+}
+
+// First fit. Zero-sized requests always succeed with an empty block.
+static bool Allocate(std::vector<ArenaBlock>* freeList, int count, ArenaBlock* block)
+{
+	*block = { 0, count };
+	if (count == 0)
+		return true;
+
+	for (size_t i = 0; i < freeList->size(); i++)
+	{
+		ArenaBlock& candidate = (*freeList)[i];
+		if (candidate.count < count)
+			continue;
+
+		block->offset = candidate.offset;
+		candidate.offset += count;
+		candidate.count -= count;
+		if (candidate.count == 0)
+			freeList->erase(freeList->begin() + i);
+		return true;
+	}
+	return false;
+}
+
+static void Free(std::vector<ArenaBlock>* freeList, ArenaBlock block)
+{
+	if (block.count == 0)
+		return;
+
+	auto next = std::lower_bound(freeList->begin(), freeList->end(), block,
+		[](const ArenaBlock& a, const ArenaBlock& b) { return a.offset < b.offset; });
+	size_t i = next - freeList->begin();
+	freeList->insert(next, block);
+
+	// Merge with the following block, then with the preceding one
+	std::vector<ArenaBlock>& blocks = *freeList;
+	if (i + 1 < blocks.size() && blocks[i].offset + blocks[i].count == blocks[i + 1].offset)
+	{
+		blocks[i].count += blocks[i + 1].count;
+		blocks.erase(blocks.begin() + i + 1);
+	}
+	if (i > 0 && blocks[i - 1].offset + blocks[i - 1].count == blocks[i].offset)
+	{
+		blocks[i - 1].count += blocks[i].count;
+		blocks.erase(blocks.begin() + i);
+	}
+}
+
+static void FreeSpace(const std::vector<ArenaBlock>& freeList, int* total, int* largest)
+{
+	*total = *largest = 0;
+	for (const ArenaBlock& block : freeList)
+	{
+		*total += block.count;
+		*largest = std::max(*largest, block.count);
+	}
+}
+
+// Copies every mesh's blocks to the front of new buffers of the given capacities, in their current order
+static void Repack(GeometryArena* arena, int vertexCapacity, int indexCapacity)
+{
+	GLuint vbo = CreateBuffer(vertexCapacity * arena->vertexSize);
+	GLuint ebo = CreateBuffer(indexCapacity * sizeof(uint32_t));
+
+	std::vector<Mesh*> meshes = arena->meshes;
+	std::sort(meshes.begin(), meshes.end(), [](const Mesh* a, const Mesh* b) { return a->vertexBlock.offset < b->vertexBlock.offset; });
+
+	int vertexEnd = 0, indexEnd = 0;
+	for (Mesh* mesh : meshes)
+	{
+		if (mesh->vertexBlock.count > 0)
+			glCopyNamedBufferSubData(arena->vbo, vbo, mesh->vertexBlock.offset * arena->vertexSize,
+				vertexEnd * arena->vertexSize, mesh->vertexBlock.count * arena->vertexSize);
+		if (mesh->indexBlock.count > 0)
+			glCopyNamedBufferSubData(arena->ebo, ebo, mesh->indexBlock.offset * sizeof(uint32_t),
+				indexEnd * sizeof(uint32_t), mesh->indexBlock.count * sizeof(uint32_t));
+		mesh->vertexBlock.offset = vertexEnd;
+		mesh->indexBlock.offset = indexEnd;
+		vertexEnd += mesh->vertexBlock.count;
+		indexEnd += mesh->indexBlock.count;
+	}
+
+	glDeleteBuffers(1, &arena->vbo);
+	glDeleteBuffers(1, &arena->ebo);
+	arena->vbo = vbo;
+	arena->ebo = ebo;
+	arena->vertexCapacity = vertexCapacity;
+	arena->indexCapacity = indexCapacity;
+	AttachBuffers(arena);
+
+	arena->freeVertices.clear();
+	arena->freeIndices.clear();
+	Free(&arena->freeVertices, { vertexEnd, vertexCapacity - vertexEnd });
+	Free(&arena->freeIndices, { indexEnd, indexCapacity - indexEnd });
+}
+
+void CreateArena(GeometryArena* arena, int vertexCapacity, int indexCapacity, VertexLayout layout)
+{
+	assert(layout == LAYOUT_INTERLEAVED || layout == LAYOUT_QUANTIZED, "Arenas store a single vertex buffer");
+	arena->layout = layout;
+	arena->vertexSize = layout == LAYOUT_QUANTIZED ? sizeof(PackedVertex) : sizeof(Vertex);
+
+	// Same attribute locations & formats as Upload, all read from binding 0
+	glCreateVertexArrays(1, &arena->vao);
+	if (layout == LAYOUT_QUANTIZED)
+	{
+		glVertexArrayAttribFormat(arena->vao, 0, 3, GL_UNSIGNED_SHORT, GL_TRUE, offsetof(PackedVertex, position));
+		glVertexArrayAttribFormat(arena->vao, 1, 2, GL_SHORT, GL_TRUE, offsetof(PackedVertex, normal));
+		glVertexArrayAttribFormat(arena->vao, 2, 2, GL_HALF_FLOAT, GL_FALSE, offsetof(PackedVertex, tcoord));
+	}
+	else
+	{
+		glVertexArrayAttribFormat(arena->vao, 0, 3, GL_FLOAT, GL_FALSE, offsetof(Vertex, position));
+		glVertexArrayAttribFormat(arena->vao, 1, 3, GL_FLOAT, GL_FALSE, offsetof(Vertex, normal));
+		glVertexArrayAttribFormat(arena->vao, 2, 2, GL_FLOAT, GL_FALSE, offsetof(Vertex, tcoord));
+	}
+	for (GLuint attribute = 0; attribute < 3; attribute++)
+	{
+		glVertexArrayAttribBinding(arena->vao, attribute, 0);
+		glEnableVertexArrayAttrib(arena->vao, attribute);
+	}
+
+	arena->vbo = CreateBuffer(vertexCapacity * arena->vertexSize);
+	arena->ebo = CreateBuffer(indexCapacity * sizeof(uint32_t));
+	arena->vertexCapacity = vertexCapacity;
+	arena->indexCapacity = indexCapacity;
+	AttachBuffers(arena);
+
+	arena->freeVertices = { { 0, vertexCapacity } };
+	arena->freeIndices = { { 0, indexCapacity } };
+	arena->meshes.clear();
+}
+
+void DestroyArena(GeometryArena* arena)
+{
+	for (Mesh* mesh : arena->meshes)
+		mesh->vertexBlock = mesh->indexBlock = {};
+
+	BindVertexArray(GL_NONE);
+	glDeleteBuffers(1, &arena->ebo);
+	glDeleteBuffers(1, &arena->vbo);
+	glDeleteVertexArrays(1, &arena->vao);
+	*arena = {};
+}
+
+void AddToArena(GeometryArena* arena, Mesh* mesh)
+{
+	assert(!mesh->indices.empty(), "Arena meshes must be indexed");
+	assert(std::find(arena->meshes.begin(), arena->meshes.end(), mesh) == arena->meshes.end(), "Mesh is already in the arena");
+
+	// Quantizing also writes the mesh's dequantize, which draws from the arena apply
+	std::vector<Vertex> vertices;
+	std::vector<PackedVertex> packedVertices;
+	const void* vertexData;
+	bool parallel = mesh->positions.size() >= 65536;
+	if (arena->layout == LAYOUT_QUANTIZED)
+	{
+		Quantize(*mesh, &packedVertices, &mesh->dequantize, parallel);
+		vertexData = packedVertices.data();
+	}
+	else
+	{
+		Interleave(*mesh, &vertices, parallel);
+		vertexData = vertices.data();
+	}
+	int vertexCount = (int)mesh->positions.size();
+	int indexCount = (int)(mesh->indices.size() + mesh->lodIndices.size());
+
+	ArenaBlock vertexBlock, indexBlock;
+	bool vertexFits = Allocate(&arena->freeVertices, vertexCount, &vertexBlock);
+	bool indexFits = vertexFits && Allocate(&arena->freeIndices, indexCount, &indexBlock);
+	if (!indexFits)
+	{
+		if (vertexFits)
+			Free(&arena->freeVertices, vertexBlock);
+
+		// Defragment if there's enough space overall, otherwise grow whichever buffer is short
+		int freeVertices, freeIndices, largest;
+		FreeSpace(arena->freeVertices, &freeVertices, &largest);
+		FreeSpace(arena->freeIndices, &freeIndices, &largest);
+		int vertexCapacity = arena->vertexCapacity, indexCapacity = arena->indexCapacity;
+		if (freeVertices < vertexCount)
+			vertexCapacity = std::max(vertexCapacity * 2, vertexCapacity - freeVertices + vertexCount);
+		if (freeIndices < indexCount)
+			indexCapacity = std::max(indexCapacity * 2, indexCapacity - freeIndices + indexCount);
+
+		Repack(arena, vertexCapacity, indexCapacity);
+		printf("Geometry arena repacked to %d vertices & %d indices\n", vertexCapacity, indexCapacity);
+		// Repacking leaves one free block per buffer at least as large as the mesh needs, so this only fails if Repack is broken
+		if (!Allocate(&arena->freeVertices, vertexCount, &vertexBlock) || !Allocate(&arena->freeIndices, indexCount, &indexBlock))
+		{
+			printf("**Error: repacked geometry arena can't fit %d vertices & %d indices**\n", vertexCount, indexCount);
+			abort();
+		}
+	}
+
+	// LOD indices follow the full mesh's indices, same as in a mesh's own element buffer
+	glNamedBufferSubData(arena->vbo, vertexBlock.offset * arena->vertexSize, vertexCount * arena->vertexSize, vertexData);
+	glNamedBufferSubData(arena->ebo, indexBlock.offset * sizeof(uint32_t), mesh->indices.size() * sizeof(uint32_t), mesh->indices.data());
+	if (!mesh->lodIndices.empty())
+		glNamedBufferSubData(arena->ebo, (indexBlock.offset + mesh->indices.size()) * sizeof(uint32_t),
+			mesh->lodIndices.size() * sizeof(uint32_t), mesh->lodIndices.data());
+
+	mesh->vertexBlock = vertexBlock;
+	mesh->indexBlock = indexBlock;
+	mesh->indexType = GL_UNSIGNED_INT;
+	mesh->layout = arena->layout;
+	arena->meshes.push_back(mesh);
+}
+
+void RemoveFromArena(GeometryArena* arena, Mesh* mesh)
+{
+	auto it = std::find(arena->meshes.begin(), arena->meshes.end(), mesh);
+	if (it == arena->meshes.end())
+		return;
+
+	Free(&arena->freeVertices, mesh->vertexBlock);
+	Free(&arena->freeIndices, mesh->indexBlock);
+	mesh->vertexBlock = mesh->indexBlock = {};
+	*it = arena->meshes.back();
+	arena->meshes.pop_back();
+}
+
+void DefragmentArena(GeometryArena* arena)
+{
+	Repack(arena, arena->vertexCapacity, arena->indexCapacity);
+}
+
+void ArenaFreeSpace(const GeometryArena& arena, int* freeVertices, int* largestVertexBlock, int* freeIndices, int* largestIndexBlock)
+{
+	FreeSpace(arena.freeVertices, freeVertices, largestVertexBlock);
+	FreeSpace(arena.freeIndices, freeIndices, largestIndexBlock);
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <glad/glad.h>
+#include <vector>
+#include "Mesh.h"
+
+// One vertex buffer (Vertex or PackedVertex structs) & one element buffer of 32-bit indices shared by many meshes behind a single VAO.
+// Each mesh owns a block of each buffer: its indices stay mesh-relative and are drawn with the block's offset as base vertex,
+// so consecutive arena draws never switch VAOs and several meshes can go out in one multi-draw.
+struct GeometryArena
+{
+	GLuint vao = GL_NONE;
+	GLuint vbo = GL_NONE;
+	GLuint ebo = GL_NONE;
+	int vertexCapacity = 0;
+	int indexCapacity = 0;
+	VertexLayout layout = LAYOUT_INTERLEAVED;	// LAYOUT_INTERLEAVED or LAYOUT_QUANTIZED, fixed at creation
+	size_t vertexSize = 0;						// sizeof(Vertex) or sizeof(PackedVertex)
+
+	// Unused blocks sorted by offset, neighbours are always merged
+	std::vector<ArenaBlock> freeVertices;
+	std::vector<ArenaBlock> freeIndices;
+
+	// Meshes with blocks in the arena, so defragmenting can move them. They mustn't move in memory while resident.
+	std::vector<Mesh*> meshes;
+};
+
+// Capacities are in vertices & indices. Both grow (by at least double) when an upload doesn't fit.
+// Quantized arenas store every mesh as PackedVertex structs, and draws from them must apply each mesh's dequantize.
+void CreateArena(GeometryArena* arena, int vertexCapacity = 1 << 18, int indexCapacity = 1 << 20, VertexLayout layout = LAYOUT_INTERLEAVED);
+void DestroyArena(GeometryArena* arena);
+
+// Upload & DestroyMesh call these for meshes whose arena was set before CreateMesh, so they rarely need calling directly.
+// Adding copies the mesh's CPU data into newly allocated blocks (defragmenting or growing the arena if needed).
+void AddToArena(GeometryArena* arena, Mesh* mesh);
+void RemoveFromArena(GeometryArena* arena, Mesh* mesh);
+
+// Packs every mesh's blocks to the front of new buffers, leaving one free block at the end of each.
+// Runs on the GPU (buffer to buffer copies) and updates the meshes' blocks, so CPU data may already be released.
+void DefragmentArena(GeometryArena* arena);
+
+// Vertices & indices not used by any mesh, and the largest block of each an upload could take without defragmenting
+void ArenaFreeSpace(const GeometryArena& arena, int* freeVertices, int* largestVertexBlock, int* freeIndices, int* largestIndexBlock);
@@ -1,6 +1,9 @@
 #pragma once
+#include <atomic>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
+#include <limits>
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -23,6 +26,42 @@
 #define RAD2DEG (180.0f/PI)
 #endif
 
+// True while the compiler evaluates a constant expression. Lets constexpr functions use libm and
+// SIMD at run time and portable scalar code at compile time (MSVC 19.25+, GCC 9+, Clang 9+).
+#ifndef MATH_IS_CONSTANT_EVALUATED
+#define MATH_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+
+// Seed of the per-thread generators behind Random(min, max)
+#ifndef MATH_RANDOM_SEED
+#define MATH_RANDOM_SEED 0x2024ull
+#endif
+
+//----------------------------------------------------------------------------------
+// SIMD backend (selected at compile time)
+//----------------------------------------------------------------------------------
+// MATH_SSE  - 128-bit SSE2, always available on x64
+// MATH_AVX  - 256-bit AVX (/arch:AVX or -mavx), used on top of MATH_SSE
+// MATH_NEON - 128-bit NEON, arm64
+// Define MATH_SCALAR before including Math.h to force the scalar reference path.
+#ifndef MATH_SCALAR
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MATH_SSE
+#if defined(__AVX__)
+#define MATH_AVX
+#endif
+#include <immintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define MATH_NEON
+#include <arm_neon.h>
+#endif
+#endif
+
+#if defined(MATH_SSE)
+// Lane order x, y, z, w (_MM_SHUFFLE takes them in reverse)
+#define MATH_SHUFFLE(x, y, z, w) _MM_SHUFFLE(w, z, y, x)
+#endif
+
 typedef struct float3 {
     float v[3]{};
 } float3;
@@ -47,57 +86,57 @@ struct Vector2 {
     float x;
     float y;
 
-    RMAPI Vector2 operator+=(Vector2 v);
-    RMAPI Vector2 operator-=(Vector2 v);
-    RMAPI Vector2 operator*=(Vector2 v);
-    RMAPI Vector2 operator/=(Vector2 v);
+    RMAPI constexpr Vector2 operator+=(Vector2 v);
+    RMAPI constexpr Vector2 operator-=(Vector2 v);
+    RMAPI constexpr Vector2 operator*=(Vector2 v);
+    RMAPI constexpr Vector2 operator/=(Vector2 v);
 
-    RMAPI Vector2 operator+=(float f);
-    RMAPI Vector2 operator-=(float f);
-    RMAPI Vector2 operator*=(float f);
-    RMAPI Vector2 operator/=(float f);
+    RMAPI constexpr Vector2 operator+=(float f);
+    RMAPI constexpr Vector2 operator-=(float f);
+    RMAPI constexpr Vector2 operator*=(float f);
+    RMAPI constexpr Vector2 operator/=(float f);
 
-    RMAPI operator Vector3() const;
+    RMAPI constexpr operator Vector3() const;
 };
 
-RMAPI Vector2 operator+(Vector2 a, Vector2 b);
-RMAPI Vector2 operator-(Vector2 a, Vector2 b);
-RMAPI Vector2 operator*(Vector2 a, Vector2 b);
-RMAPI Vector2 operator/(Vector2 a, Vector2 b);
+RMAPI constexpr Vector2 operator+(Vector2 a, Vector2 b);
+RMAPI constexpr Vector2 operator-(Vector2 a, Vector2 b);
+RMAPI constexpr Vector2 operator*(Vector2 a, Vector2 b);
+RMAPI constexpr Vector2 operator/(Vector2 a, Vector2 b);
 
-RMAPI Vector2 operator+(Vector2 a, float b);
-RMAPI Vector2 operator-(Vector2 a, float b);
-RMAPI Vector2 operator*(Vector2 a, float b);
-RMAPI Vector2 operator/(Vector2 a, float b);
+RMAPI constexpr Vector2 operator+(Vector2 a, float b);
+RMAPI constexpr Vector2 operator-(Vector2 a, float b);
+RMAPI constexpr Vector2 operator*(Vector2 a, float b);
+RMAPI constexpr Vector2 operator/(Vector2 a, float b);
 
 struct Vector3 {
     float x;
     float y;
     float z;
 
-    RMAPI Vector3 operator+=(Vector3 v);
-    RMAPI Vector3 operator-=(Vector3 v);
-    RMAPI Vector3 operator*=(Vector3 v);
-    RMAPI Vector3 operator/=(Vector3 v);
+    RMAPI constexpr Vector3 operator+=(Vector3 v);
+    RMAPI constexpr Vector3 operator-=(Vector3 v);
+    RMAPI constexpr Vector3 operator*=(Vector3 v);
+    RMAPI constexpr Vector3 operator/=(Vector3 v);
 
-    RMAPI Vector3 operator+=(float f);
-    RMAPI Vector3 operator-=(float f);
-    RMAPI Vector3 operator*=(float f);
-    RMAPI Vector3 operator/=(float f);
+    RMAPI constexpr Vector3 operator+=(float f);
+    RMAPI constexpr Vector3 operator-=(float f);
+    RMAPI constexpr Vector3 operator*=(float f);
+    RMAPI constexpr Vector3 operator/=(float f);
 
-    RMAPI operator Vector2() const;
-    RMAPI operator Vector4() const;
+    RMAPI constexpr operator Vector2() const;
+    RMAPI constexpr operator Vector4() const;
 };
 
-RMAPI Vector3 operator+(Vector3 a, Vector3 b);
-RMAPI Vector3 operator-(Vector3 a, Vector3 b);
-RMAPI Vector3 operator*(Vector3 a, Vector3 b);
-RMAPI Vector3 operator/(Vector3 a, Vector3 b);
+RMAPI constexpr Vector3 operator+(Vector3 a, Vector3 b);
+RMAPI constexpr Vector3 operator-(Vector3 a, Vector3 b);
+RMAPI constexpr Vector3 operator*(Vector3 a, Vector3 b);
+RMAPI constexpr Vector3 operator/(Vector3 a, Vector3 b);
 
-RMAPI Vector3 operator+(Vector3 a, float b);
-RMAPI Vector3 operator-(Vector3 a, float b);
-RMAPI Vector3 operator*(Vector3 a, float b);
-RMAPI Vector3 operator/(Vector3 a, float b);
+RMAPI constexpr Vector3 operator+(Vector3 a, float b);
+RMAPI constexpr Vector3 operator-(Vector3 a, float b);
+RMAPI constexpr Vector3 operator*(Vector3 a, float b);
+RMAPI constexpr Vector3 operator/(Vector3 a, float b);
 
 struct Vector4 {
     float x;
@@ -105,34 +144,36 @@ struct Vector4 {
     float z;
     float w;
 
-    RMAPI Vector4 operator+=(Vector4 v);
-    RMAPI Vector4 operator-=(Vector4 v);
-    RMAPI Vector4 operator*=(Vector4 v);
-    RMAPI Vector4 operator/=(Vector4 v);
+    RMAPI constexpr Vector4 operator+=(Vector4 v);
+    RMAPI constexpr Vector4 operator-=(Vector4 v);
+    RMAPI constexpr Vector4 operator*=(Vector4 v);
+    RMAPI constexpr Vector4 operator/=(Vector4 v);
 
-    RMAPI Vector4 operator+=(float f);
-    RMAPI Vector4 operator-=(float f);
-    RMAPI Vector4 operator*=(float f);
-    RMAPI Vector4 operator/=(float f);
+    RMAPI constexpr Vector4 operator+=(float f);
+    RMAPI constexpr Vector4 operator-=(float f);
+    RMAPI constexpr Vector4 operator*=(float f);
+    RMAPI constexpr Vector4 operator/=(float f);
 
-    RMAPI operator Vector3() const;
+    RMAPI constexpr operator Vector3() const;
 };
 
-RMAPI Vector4 operator+(Vector4 a, Vector4 b);
-RMAPI Vector4 operator-(Vector4 a, Vector4 b);
-RMAPI Vector4 operator*(Vector4 a, Vector4 b);
-RMAPI Vector4 operator/(Vector4 a, Vector4 b);
+RMAPI constexpr Vector4 operator+(Vector4 a, Vector4 b);
+RMAPI constexpr Vector4 operator-(Vector4 a, Vector4 b);
+RMAPI constexpr Vector4 operator*(Vector4 a, Vector4 b);
+RMAPI constexpr Vector4 operator/(Vector4 a, Vector4 b);
 
-RMAPI Vector4 operator+(Vector4 a, float b);
-RMAPI Vector4 operator-(Vector4 a, float b);
-RMAPI Vector4 operator*(Vector4 a, float b);
-RMAPI Vector4 operator/(Vector4 a, float b);
+RMAPI constexpr Vector4 operator+(Vector4 a, float b);
+RMAPI constexpr Vector4 operator-(Vector4 a, float b);
+RMAPI constexpr Vector4 operator*(Vector4 a, float b);
+RMAPI constexpr Vector4 operator/(Vector4 a, float b);
 
 typedef Vector4 Quaternion;
 
 // Logically column-major (c0 = [m0, m1, m2, m3]).
 // Physically row-major (m[0] = m0, m[1] = m4, m[2] = m8, m[3] = m12).
 // Transpose to change memory to column-major (OpenGL's memory layout).
+// To upload without transposing on the CPU, pass transpose = GL_TRUE to glUniformMatrix4fv,
+// or declare uniform/shader-storage blocks as layout(row_major) and copy Matrix arrays as-is.
 typedef struct Matrix {
     float m0, m4, m8, m12;      // Matrix first row (4 components)
     float m1, m5, m9, m13;      // Matrix second row (4 components)
@@ -140,15 +181,46 @@ typedef struct Matrix {
     float m3, m7, m11, m15;     // Matrix fourth row (4 components)
 } Matrix;
 
-RMAPI Matrix operator+(Matrix a, Matrix b);
-RMAPI Matrix operator-(Matrix a, Matrix b);
-RMAPI Matrix operator*(Matrix a, Matrix b);
+RMAPI constexpr Matrix operator+(Matrix a, Matrix b);
+RMAPI constexpr Matrix operator-(Matrix a, Matrix b);
+RMAPI constexpr Matrix operator*(Matrix a, Matrix b);
 // No need for matrix division.
 
-RMAPI Vector4 operator*(Matrix m, Vector4 v);
-RMAPI Vector3 operator*(Matrix m, Vector3 v);
-RMAPI Vector2 operator*(Matrix m, Vector2 v);
-RMAPI Vector3 operator*(Quaternion a, Vector3 b);
+RMAPI constexpr Vector4 operator*(Matrix m, Vector4 v);
+RMAPI constexpr Vector3 operator*(Matrix m, Vector3 v);
+RMAPI constexpr Vector2 operator*(Matrix m, Vector2 v);
+RMAPI constexpr Vector3 operator*(Quaternion a, Vector3 b);
+
+// Affine transform (3x4). Same member naming and memory order as Matrix without the projective row,
+// which is implicitly (0, 0, 0, 1). Holds anything built from Translate/Rotate/Scale/ToMatrix(Quaternion).
+typedef struct Transform {
+    float m0, m4, m8, m12;      // Transform first row (4 components)
+    float m1, m5, m9, m13;      // Transform second row (4 components)
+    float m2, m6, m10, m14;     // Transform third row (4 components)
+} Transform;
+
+RMAPI constexpr Transform operator*(Transform a, Transform b);
+RMAPI constexpr Matrix operator*(Transform a, Matrix b);
+RMAPI constexpr Vector3 operator*(Transform t, Vector3 v);
+
+RMAPI constexpr Transform ToTransform(Matrix mat);
+RMAPI constexpr Matrix NormalMatrix(Transform t);
+
+// Plane with dot(normal, p) + d = 0. Points with a positive distance are in front of the plane.
+typedef struct Plane {
+    Vector3 normal;
+    float d;
+} Plane;
+
+// View frustum as 6 inward-facing planes: left, right, bottom, top, near, far
+typedef struct ViewFrustum {
+    Plane planes[6];
+} ViewFrustum;
+
+// Random number generator state (xoshiro128**). Not thread-safe, so use one per thread or per task.
+typedef struct Rng {
+    uint32_t s[4];
+} Rng;
 
 constexpr Vector2 V2_RIGHT = { 1.0f, 0.0f };
 constexpr Vector2 V2_UP = { 0.0f, 1.0f };
@@ -176,7 +248,7 @@ constexpr Vector4 V4_IDENTITY = { 0.0f, 0.0f, 0.0f, 1.0f };
 // (I don't like the above macros because you can just do ToFloatN.v for float*)
 
 // Get Vector3 as float array
-RMAPI float3 ToFloat3(Vector3 v)
+RMAPI constexpr float3 ToFloat3(Vector3 v)
 {
     float3 buffer = { 0 };
 
@@ -187,7 +259,7 @@ RMAPI float3 ToFloat3(Vector3 v)
     return buffer;
 }
 
-RMAPI float9 ToFloat9(Matrix mat)
+RMAPI constexpr float9 ToFloat9(Matrix mat)
 {
     float9 result = { 0 };
 
@@ -208,7 +280,7 @@ RMAPI float9 ToFloat9(Matrix mat)
 
 // Get float array of matrix data (transposes the matrix from row-major to column-major)!
 // col0 = v[0-3], col1 = v[4-7], col2 = v[8-11], col3 = v[12-15]. Inspect in debugger!!!!
-RMAPI float16 ToFloat16(Matrix mat)
+RMAPI constexpr float16 ToFloat16(Matrix mat)
 {
     float16 result = { 0 };
 
@@ -232,18 +304,242 @@ RMAPI float16 ToFloat16(Matrix mat)
     return result;
 }
 
+//----------------------------------------------------------------------------------
+// Module Functions Definition - constexpr libm replacements
+//----------------------------------------------------------------------------------
+// Sqrt, Sin, Cos etc. call libm at run time and the *Constexpr versions below at compile time.
+// The compile-time versions work in double precision and round to float, so they can differ
+// from libm by 1 ulp. Sin & cos reduce in double, so keep compile-time angles below ~1e6.
+
+RMAPI constexpr double SqrtConstexpr(double x)
+{
+    if (x != x || x < 0.0) return std::numeric_limits<double>::quiet_NaN();
+    if (x == 0.0 || x == std::numeric_limits<double>::infinity()) return x;
+
+    // Newton-Raphson from a power-of-4 scaled guess, stops once the estimate no longer changes
+    double guess = 1.0;
+    for (double y = x; y > 4.0; y *= 0.25) guess *= 2.0;
+    for (double y = x; y < 0.25; y *= 4.0) guess *= 0.5;
+    for (int i = 0; i < 16; i++)
+    {
+        double next = 0.5 * (guess + x / guess);
+        if (next == guess) break;
+        guess = next;
+    }
+    return guess;
+}
+
+RMAPI constexpr double SinConstexpr(double x)
+{
+    // Reduce to [-pi, pi] then sum the Taylor series until the terms vanish
+    const double twoPi = 6.283185307179586476925;
+    double k = x / twoPi;
+    long long n = (long long)(k < 0.0 ? k - 0.5 : k + 0.5);
+    double r = x - (double)n * twoPi;
+
+    double term = r, sum = r;
+    for (int i = 1; i < 32 && term != 0.0; i++)
+    {
+        term *= -r * r / ((2.0 * i) * (2.0 * i + 1.0));
+        sum += term;
+    }
+    return sum;
+}
+
+RMAPI constexpr double CosConstexpr(double x)
+{
+    return SinConstexpr(x + 1.570796326794896619231);
+}
+
+RMAPI constexpr double AtanConstexpr(double x)
+{
+    if (x < 0.0) return -AtanConstexpr(-x);
+    if (x > 1.0) return 1.570796326794896619231 - AtanConstexpr(1.0 / x);
+
+    // Halve the angle twice (atan(x) = 2 atan(x / (1 + sqrt(1 + x^2)))) so the series converges fast
+    x = x / (1.0 + SqrtConstexpr(1.0 + x * x));
+    x = x / (1.0 + SqrtConstexpr(1.0 + x * x));
+
+    double term = x, sum = x;
+    for (int i = 1; i < 64 && term != 0.0; i++)
+    {
+        term *= -x * x;
+        sum += term / (2.0 * i + 1.0);
+    }
+    return 4.0 * sum;
+}
+
+RMAPI constexpr double Atan2Constexpr(double y, double x)
+{
+    const double pi = 3.141592653589793238463;
+    if (x > 0.0) return AtanConstexpr(y / x);
+    if (x < 0.0) return y < 0.0 ? AtanConstexpr(y / x) - pi : AtanConstexpr(y / x) + pi;
+    if (y > 0.0) return pi * 0.5;
+    if (y < 0.0) return -pi * 0.5;
+    return 0.0;
+}
+
+// Square root
+RMAPI constexpr float Sqrt(float x)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) return (float)SqrtConstexpr(x);
+    return sqrtf(x);
+}
+
+// Sine (radians)
+RMAPI constexpr float Sin(float x)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) return (float)SinConstexpr(x);
+    return sinf(x);
+}
+
+// Cosine (radians)
+RMAPI constexpr float Cos(float x)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) return (float)CosConstexpr(x);
+    return cosf(x);
+}
+
+// Tangent (radians)
+RMAPI constexpr double Tan(double x)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) return SinConstexpr(x) / CosConstexpr(x);
+    return tan(x);
+}
+
+// Arc sine, x in [-1, 1]
+RMAPI constexpr float Asin(float x)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) return (float)Atan2Constexpr(x, SqrtConstexpr((1.0 - x) * (1.0 + x)));
+    return asinf(x);
+}
+
+// Arc cosine, x in [-1, 1]
+RMAPI constexpr float Acos(float x)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) return (float)Atan2Constexpr(SqrtConstexpr((1.0 - x) * (1.0 + x)), x);
+    return acosf(x);
+}
+
+// Angle of (x, y) from the x-axis in [-pi, pi]
+RMAPI constexpr float Atan2(float y, float x)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) return (float)Atan2Constexpr(y, x);
+    return atan2f(y, x);
+}
+
+// Absolute value
+RMAPI constexpr float Abs(float x)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) return x < 0.0f ? -x : x;
+    return fabsf(x);
+}
+
+// Smaller of a and b (a NaN argument is ignored, same as fminf)
+RMAPI constexpr float Min(float a, float b)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) return a != a ? b : (b != b ? a : (b < a ? b : a));
+    return fminf(a, b);
+}
+
+// Larger of a and b (a NaN argument is ignored, same as fmaxf)
+RMAPI constexpr float Max(float a, float b)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) return a != a ? b : (b != b ? a : (b > a ? b : a));
+    return fmaxf(a, b);
+}
+
+// Largest integer value not greater than x
+RMAPI constexpr float Floor(float x)
+{
+    if (MATH_IS_CONSTANT_EVALUATED())
+    {
+        // Floats this large are already integers
+        if (x != x || x >= 8388608.0f || x <= -8388608.0f) return x;
+        float t = (float)(long long)x;
+        return t > x ? t - 1.0f : t;
+    }
+    return floorf(x);
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Scalar math
 //----------------------------------------------------------------------------------
 
+// splitmix64 step, used to expand seeds into generator state
+RMAPI uint64_t SplitMix64(uint64_t* state)
+{
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+// Create a generator. Each (seed, stream) pair gives an independent sequence.
+RMAPI Rng CreateRng(uint64_t seed, uint64_t stream = 0)
+{
+    uint64_t mix = stream;
+    uint64_t state = seed ^ SplitMix64(&mix);
+    uint64_t a = SplitMix64(&state);
+    uint64_t b = SplitMix64(&state);
+
+    Rng rng = { { (uint32_t)a, (uint32_t)(a >> 32), (uint32_t)b, (uint32_t)(b >> 32) } };
+    if ((rng.s[0] | rng.s[1] | rng.s[2] | rng.s[3]) == 0)
+        rng.s[0] = 1;
+    return rng;
+}
+
+// Next 32 random bits
+RMAPI uint32_t NextUint(Rng* rng)
+{
+    uint32_t* s = rng->s;
+    uint32_t x = s[1] * 5;
+    uint32_t result = ((x << 7) | (x >> 25)) * 9;
+    uint32_t t = s[1] << 9;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = (s[3] << 11) | (s[3] >> 21);
+    return result;
+}
+
+// Random value in [0, 1) with 24 bits of precision
+RMAPI float NextFloat(Rng* rng)
+{
+    return (float)(NextUint(rng) >> 8) * (1.0f / 16777216.0f);
+}
+
 // Random value between min and max (can be negative)
+RMAPI float Random(Rng* rng, float min, float max)
+{
+    return min + NextFloat(rng) * (max - min);
+}
+
+// Generator of the calling thread. The first thread to use it gets stream 0, the next stream 1 and so on.
+RMAPI Rng* ThreadRng()
+{
+    static std::atomic<uint64_t> streams{ 0 };
+    thread_local Rng rng = CreateRng(MATH_RANDOM_SEED, streams++);
+    return &rng;
+}
+
+// Reseed the calling thread's generator
+RMAPI void SeedRandom(uint64_t seed)
+{
+    *ThreadRng() = CreateRng(seed);
+}
+
+// Random value between min and max (can be negative). Thread-safe, uses the calling thread's generator.
 RMAPI float Random(float min, float max)
 {
-    return min + (rand() / ((float)RAND_MAX / (max - min)));
+    return Random(ThreadRng(), min, max);
 }
 
 // Clamp float value
-RMAPI float Clamp(float value, float min, float max)
+RMAPI constexpr float Clamp(float value, float min, float max)
 {
     float result = (value < min) ? min : value;
 
@@ -253,7 +549,7 @@ RMAPI float Clamp(float value, float min, float max)
 }
 
 // Calculate linear interpolation between two floats
-RMAPI float Lerp(float start, float end, float amount)
+RMAPI constexpr float Lerp(float start, float end, float amount)
 {
     float result = start + amount * (end - start);
 
@@ -261,13 +557,13 @@ RMAPI float Lerp(float start, float end, float amount)
 }
 
 // 1d tri-linear interpolation
-RMAPI float Terp(float A, float B, float C, Vector3 t)
+RMAPI constexpr float Terp(float A, float B, float C, Vector3 t)
 {
     return A * t.x + B * t.y + C * t.z;
 }
 
 // Normalize input value within input range
-RMAPI float Normalize(float value, float start, float end)
+RMAPI constexpr float Normalize(float value, float start, float end)
 {
     float result = (value - start) / (end - start);
 
@@ -275,7 +571,7 @@ RMAPI float Normalize(float value, float start, float end)
 }
 
 // Remap input value within input range to output range
-RMAPI float Remap(float value, float inputStart, float inputEnd, float outputStart, float outputEnd)
+RMAPI constexpr float Remap(float value, float inputStart, float inputEnd, float outputStart, float outputEnd)
 {
     float result = (value - inputStart) / (inputEnd - inputStart) * (outputEnd - outputStart) + outputStart;
 
@@ -283,17 +579,17 @@ RMAPI float Remap(float value, float inputStart, float inputEnd, float outputSta
 }
 
 // Wrap input value from min to max
-RMAPI float Wrap(float value, float min, float max)
+RMAPI constexpr float Wrap(float value, float min, float max)
 {
-    float result = value - (max - min) * floorf((value - min) / (max - min));
+    float result = value - (max - min) * Floor((value - min) / (max - min));
 
     return result;
 }
 
 // Check whether two given floats are almost equal
-RMAPI int Equals(float x, float y)
+RMAPI constexpr int Equals(float x, float y)
 {
-    int result = (fabsf(x - y)) <= (EPSILON * fmaxf(1.0f, fmaxf(fabsf(x), fabsf(y))));
+    int result = (Abs(x - y)) <= (EPSILON * Max(1.0f, Max(Abs(x), Abs(y))));
 
     return result;
 }
@@ -303,7 +599,7 @@ RMAPI int Equals(float x, float y)
 //----------------------------------------------------------------------------------
 
 // Add two vectors (v1 + v2)
-RMAPI Vector2 Add(Vector2 v1, Vector2 v2)
+RMAPI constexpr Vector2 Add(Vector2 v1, Vector2 v2)
 {
     Vector2 result = { v1.x + v2.x, v1.y + v2.y };
 
@@ -311,7 +607,7 @@ RMAPI Vector2 Add(Vector2 v1, Vector2 v2)
 }
 
 // Add vector and float value
-RMAPI Vector2 Add(Vector2 v, float add)
+RMAPI constexpr Vector2 Add(Vector2 v, float add)
 {
     Vector2 result = { v.x + add, v.y + add };
 
@@ -319,7 +615,7 @@ RMAPI Vector2 Add(Vector2 v, float add)
 }
 
 // Subtract two vectors (v1 - v2)
-RMAPI Vector2 Subtract(Vector2 v1, Vector2 v2)
+RMAPI constexpr Vector2 Subtract(Vector2 v1, Vector2 v2)
 {
     Vector2 result = { v1.x - v2.x, v1.y - v2.y };
 
@@ -327,22 +623,22 @@ RMAPI Vector2 Subtract(Vector2 v1, Vector2 v2)
 }
 
 // Subtract vector by float value
-RMAPI Vector2 Subtract(Vector2 v, float sub)
+RMAPI constexpr Vector2 Subtract(Vector2 v, float sub)
 {
     Vector2 result = { v.x - sub, v.y - sub };
 
     return result;
 }
 
-RMAPI float Length(Vector2 v)
+RMAPI constexpr float Length(Vector2 v)
 {
-    float result = sqrtf((v.x * v.x) + (v.y * v.y));
+    float result = Sqrt((v.x * v.x) + (v.y * v.y));
 
     return result;
 }
 
 // Calculate vector square length
-RMAPI float LengthSqr(Vector2 v)
+RMAPI constexpr float LengthSqr(Vector2 v)
 {
     float result = (v.x * v.x) + (v.y * v.y);
 
@@ -350,14 +646,14 @@ RMAPI float LengthSqr(Vector2 v)
 }
 
 // Calculate two vectors dot product
-RMAPI float Dot(Vector2 v1, Vector2 v2)
+RMAPI constexpr float Dot(Vector2 v1, Vector2 v2)
 {
     float result = (v1.x * v2.x + v1.y * v2.y);
 
     return result;
 }
 
-RMAPI float Cross(Vector2 v1, Vector2 v2)
+RMAPI constexpr float Cross(Vector2 v1, Vector2 v2)
 {
     float result = v1.x * v2.y - v1.y * v2.x;
 
@@ -365,15 +661,15 @@ RMAPI float Cross(Vector2 v1, Vector2 v2)
 }
 
 // Calculate distance between two vectors
-RMAPI float Distance(Vector2 v1, Vector2 v2)
+RMAPI constexpr float Distance(Vector2 v1, Vector2 v2)
 {
-    float result = sqrtf((v1.x - v2.x) * (v1.x - v2.x) + (v1.y - v2.y) * (v1.y - v2.y));
+    float result = Sqrt((v1.x - v2.x) * (v1.x - v2.x) + (v1.y - v2.y) * (v1.y - v2.y));
 
     return result;
 }
 
 // Calculate square distance between two vectors
-RMAPI float DistanceSqr(Vector2 v1, Vector2 v2)
+RMAPI constexpr float DistanceSqr(Vector2 v1, Vector2 v2)
 {
     float result = ((v1.x - v2.x) * (v1.x - v2.x) + (v1.y - v2.y) * (v1.y - v2.y));
 
@@ -381,7 +677,7 @@ RMAPI float DistanceSqr(Vector2 v1, Vector2 v2)
 }
 
 // -1 if below zero, +1 if above zero
-RMAPI float Sign(float value)
+RMAPI constexpr float Sign(float value)
 {
     float result = (value < 0.0f) ? -1.0f : 1.0f;
 
@@ -389,23 +685,23 @@ RMAPI float Sign(float value)
 }
 
 // Convert angle to direction
-RMAPI Vector2 Direction(float angle)
+RMAPI constexpr Vector2 Direction(float angle)
 {
-    Vector2 result = { cosf(angle), sinf(angle) };
+    Vector2 result = { Cos(angle), Sin(angle) };
 
     return result;
 }
 
 // Convert direction to angle
-RMAPI float Angle(Vector2 v)
+RMAPI constexpr float Angle(Vector2 v)
 {
-    float result = atan2f(v.y, v.x);
+    float result = Atan2(v.y, v.x);
 
     return result;
 }
 
 // Unsigned angle between two directions. Range of [0, 180]
-RMAPI float UnsignedAngle(Vector2 start, Vector2 end)
+RMAPI constexpr float UnsignedAngle(Vector2 start, Vector2 end)
 {
     float result = 0.0f;
 
@@ -414,13 +710,13 @@ RMAPI float UnsignedAngle(Vector2 start, Vector2 end)
     float dotClamp = (dot < -1.0f) ? -1.0f : dot;    // Clamp
     if (dotClamp > 1.0f) dotClamp = 1.0f;
 
-    result = acosf(dotClamp);
+    result = Acos(dotClamp);
 
     return result;
 }
 
 // Signed angle between two directions. Range = [-180, 180]
-RMAPI float SignedAngle(Vector2 from, Vector2 to)
+RMAPI constexpr float SignedAngle(Vector2 from, Vector2 to)
 {
     float sign = Sign(from.x * to.y - from.y * to.x);
     float angle = UnsignedAngle(from, to);
@@ -428,7 +724,7 @@ RMAPI float SignedAngle(Vector2 from, Vector2 to)
 }
 
 // Scale vector (multiply by value)
-RMAPI Vector2 Scale(Vector2 v, float scale)
+RMAPI constexpr Vector2 Scale(Vector2 v, float scale)
 {
     Vector2 result = { v.x * scale, v.y * scale };
 
@@ -436,21 +732,21 @@ RMAPI Vector2 Scale(Vector2 v, float scale)
 }
 
 // Project v1 onto v2
-RMAPI Vector2 Project(Vector2 v1, Vector2 v2)
+RMAPI constexpr Vector2 Project(Vector2 v1, Vector2 v2)
 {
     float t = Dot(v1, v2) / Dot(v2, v2);
     return { t * v2.x, t * v2.y };
 }
 
 // Scalar projection of v1 onto v2
-RMAPI float ProjectScalar(Vector2 v1, Vector2 v2)
+RMAPI constexpr float ProjectScalar(Vector2 v1, Vector2 v2)
 {
     float t = Dot(v1, v2) / Dot(v2, v2);
     return t;
 }
 
 // Projects point P onto line AB
-RMAPI Vector2 ProjectPointLine(Vector2 A, Vector2 B, Vector2 P)
+RMAPI constexpr Vector2 ProjectPointLine(Vector2 A, Vector2 B, Vector2 P)
 {
     Vector2 AB = Subtract(B, A);
     float t = Dot(Subtract(P, A), AB) / Dot(AB, AB);
@@ -458,7 +754,7 @@ RMAPI Vector2 ProjectPointLine(Vector2 A, Vector2 B, Vector2 P)
 }
 
 // Multiply vector by vector
-RMAPI Vector2 Multiply(Vector2 v1, Vector2 v2)
+RMAPI constexpr Vector2 Multiply(Vector2 v1, Vector2 v2)
 {
     Vector2 result = { v1.x * v2.x, v1.y * v2.y };
 
@@ -466,7 +762,7 @@ RMAPI Vector2 Multiply(Vector2 v1, Vector2 v2)
 }
 
 // Negate vector
-RMAPI Vector2 Negate(Vector2 v)
+RMAPI constexpr Vector2 Negate(Vector2 v)
 {
     Vector2 result = { -v.x, -v.y };
 
@@ -474,7 +770,7 @@ RMAPI Vector2 Negate(Vector2 v)
 }
 
 // Divide vector by vector
-RMAPI Vector2 Divide(Vector2 v1, Vector2 v2)
+RMAPI constexpr Vector2 Divide(Vector2 v1, Vector2 v2)
 {
     Vector2 result = { v1.x / v2.x, v1.y / v2.y };
 
@@ -482,10 +778,10 @@ RMAPI Vector2 Divide(Vector2 v1, Vector2 v2)
 }
 
 // Normalize provided vector
-RMAPI Vector2 Normalize(Vector2 v)
+RMAPI constexpr Vector2 Normalize(Vector2 v)
 {
     Vector2 result = { 0 };
-    float length = sqrtf((v.x * v.x) + (v.y * v.y));
+    float length = Sqrt((v.x * v.x) + (v.y * v.y));
 
     if (length > 0)
     {
@@ -498,7 +794,7 @@ RMAPI Vector2 Normalize(Vector2 v)
 }
 
 // Transforms a Vector2 by a given Matrix
-RMAPI Vector2 Multiply(Vector2 v, Matrix mat)
+RMAPI constexpr Vector2 Multiply(Vector2 v, Matrix mat)
 {
     Vector2 result = { 0 };
 
@@ -513,7 +809,7 @@ RMAPI Vector2 Multiply(Vector2 v, Matrix mat)
 }
 
 // Calculate linear interpolation between two vectors
-RMAPI Vector2 Lerp(Vector2 v1, Vector2 v2, float amount)
+RMAPI constexpr Vector2 Lerp(Vector2 v1, Vector2 v2, float amount)
 {
     Vector2 result = { 0 };
 
@@ -524,13 +820,13 @@ RMAPI Vector2 Lerp(Vector2 v1, Vector2 v2, float amount)
 }
 
 // 2d tri-linear interpolation
-RMAPI Vector2 Terp(Vector2 A, Vector2 B, Vector2 C, Vector3 t)
+RMAPI constexpr Vector2 Terp(Vector2 A, Vector2 B, Vector2 C, Vector3 t)
 {
     return A * t.x + B * t.y + C * t.z;
 }
 
 // Calculate reflected vector to normal
-RMAPI Vector2 Reflect(Vector2 v, Vector2 normal)
+RMAPI constexpr Vector2 Reflect(Vector2 v, Vector2 normal)
 {
     Vector2 result = { 0 };
 
@@ -543,12 +839,12 @@ RMAPI Vector2 Reflect(Vector2 v, Vector2 normal)
 }
 
 // Rotate vector by angle
-RMAPI Vector2 Rotate(Vector2 v, float angle)
+RMAPI constexpr Vector2 Rotate(Vector2 v, float angle)
 {
     Vector2 result = { 0 };
 
-    float cosres = cosf(angle);
-    float sinres = sinf(angle);
+    float cosres = Cos(angle);
+    float sinres = Sin(angle);
 
     result.x = v.x * cosres - v.y * sinres;
     result.y = v.x * sinres + v.y * cosres;
@@ -557,7 +853,7 @@ RMAPI Vector2 Rotate(Vector2 v, float angle)
 }
 
 // Move Vector towards target
-RMAPI Vector2 MoveTowards(Vector2 v, Vector2 target, float maxDistance)
+RMAPI constexpr Vector2 MoveTowards(Vector2 v, Vector2 target, float maxDistance)
 {
     Vector2 result = { 0 };
 
@@ -567,7 +863,7 @@ RMAPI Vector2 MoveTowards(Vector2 v, Vector2 target, float maxDistance)
 
     if ((value == 0) || ((maxDistance >= 0) && (value <= maxDistance * maxDistance))) return target;
 
-    float dist = sqrtf(value);
+    float dist = Sqrt(value);
 
     result.x = v.x + dx / dist * maxDistance;
     result.y = v.y + dy / dist * maxDistance;
@@ -576,14 +872,14 @@ RMAPI Vector2 MoveTowards(Vector2 v, Vector2 target, float maxDistance)
 }
 
 // Rotate max radians towards the target
-RMAPI Vector2 RotateTowards(Vector2 from, Vector2 to, float maxRadians)
+RMAPI constexpr Vector2 RotateTowards(Vector2 from, Vector2 to, float maxRadians)
 {
     float deltaRadians = UnsignedAngle(from, to);
-    return Rotate(from, fminf(deltaRadians, maxRadians) * Sign(Cross(from, to)));
+    return Rotate(from, Min(deltaRadians, maxRadians) * Sign(Cross(from, to)));
 }
 
 // Invert the given vector
-RMAPI Vector2 Invert(Vector2 v)
+RMAPI constexpr Vector2 Invert(Vector2 v)
 {
     Vector2 result = { 1.0f / v.x, 1.0f / v.y };
 
@@ -592,25 +888,25 @@ RMAPI Vector2 Invert(Vector2 v)
 
 // Clamp the components of the vector between
 // min and max values specified by the given vectors
-RMAPI Vector2 Clamp(Vector2 v, Vector2 min, Vector2 max)
+RMAPI constexpr Vector2 Clamp(Vector2 v, Vector2 min, Vector2 max)
 {
     Vector2 result = { 0 };
 
-    result.x = fminf(max.x, fmaxf(min.x, v.x));
-    result.y = fminf(max.y, fmaxf(min.y, v.y));
+    result.x = Min(max.x, Max(min.x, v.x));
+    result.y = Min(max.y, Max(min.y, v.y));
 
     return result;
 }
 
 // Clamp the magnitude of the vector between two min and max values
-RMAPI Vector2 Clamp(Vector2 v, float min, float max)
+RMAPI constexpr Vector2 Clamp(Vector2 v, float min, float max)
 {
     Vector2 result = v;
 
     float length = (v.x * v.x) + (v.y * v.y);
     if (length > 0.0f)
     {
-        length = sqrtf(length);
+        length = Sqrt(length);
 
         if (length < min)
         {
@@ -630,10 +926,10 @@ RMAPI Vector2 Clamp(Vector2 v, float min, float max)
 }
 
 // Check whether two given vectors are almost equal
-RMAPI bool Equals(Vector2 p, Vector2 q)
+RMAPI constexpr bool Equals(Vector2 p, Vector2 q)
 {
-    bool result = ((fabsf(p.x - q.x)) <= (EPSILON * fmaxf(1.0f, fmaxf(fabsf(p.x), fabsf(q.x))))) &&
-        ((fabsf(p.y - q.y)) <= (EPSILON * fmaxf(1.0f, fmaxf(fabsf(p.y), fabsf(q.y)))));
+    bool result = ((Abs(p.x - q.x)) <= (EPSILON * Max(1.0f, Max(Abs(p.x), Abs(q.x))))) &&
+        ((Abs(p.y - q.y)) <= (EPSILON * Max(1.0f, Max(Abs(p.y), Abs(q.y)))));
 
     return result;
 }
@@ -643,7 +939,7 @@ RMAPI bool Equals(Vector2 p, Vector2 q)
 //----------------------------------------------------------------------------------
 
 // Add two vectors
-RMAPI Vector3 Add(Vector3 v1, Vector3 v2)
+RMAPI constexpr Vector3 Add(Vector3 v1, Vector3 v2)
 {
     Vector3 result = { v1.x + v2.x, v1.y + v2.y, v1.z + v2.z };
 
@@ -651,7 +947,7 @@ RMAPI Vector3 Add(Vector3 v1, Vector3 v2)
 }
 
 // Add vector and float value
-RMAPI Vector3 Add(Vector3 v, float add)
+RMAPI constexpr Vector3 Add(Vector3 v, float add)
 {
     Vector3 result = { v.x + add, v.y + add, v.z + add };
 
@@ -659,7 +955,7 @@ RMAPI Vector3 Add(Vector3 v, float add)
 }
 
 // Subtract two vectors
-RMAPI Vector3 Subtract(Vector3 v1, Vector3 v2)
+RMAPI constexpr Vector3 Subtract(Vector3 v1, Vector3 v2)
 {
     Vector3 result = { v1.x - v2.x, v1.y - v2.y, v1.z - v2.z };
 
@@ -667,7 +963,7 @@ RMAPI Vector3 Subtract(Vector3 v1, Vector3 v2)
 }
 
 // Subtract vector by float value
-RMAPI Vector3 Subtract(Vector3 v, float sub)
+RMAPI constexpr Vector3 Subtract(Vector3 v, float sub)
 {
     Vector3 result = { v.x - sub, v.y - sub, v.z - sub };
 
@@ -675,7 +971,7 @@ RMAPI Vector3 Subtract(Vector3 v, float sub)
 }
 
 // Multiply vector by scalar
-RMAPI Vector3 Scale(Vector3 v, float scalar)
+RMAPI constexpr Vector3 Scale(Vector3 v, float scalar)
 {
     Vector3 result = { v.x * scalar, v.y * scalar, v.z * scalar };
 
@@ -683,7 +979,7 @@ RMAPI Vector3 Scale(Vector3 v, float scalar)
 }
 
 // Multiply vector by vector
-RMAPI Vector3 Multiply(Vector3 v1, Vector3 v2)
+RMAPI constexpr Vector3 Multiply(Vector3 v1, Vector3 v2)
 {
     Vector3 result = { v1.x * v2.x, v1.y * v2.y, v1.z * v2.z };
 
@@ -691,7 +987,7 @@ RMAPI Vector3 Multiply(Vector3 v1, Vector3 v2)
 }
 
 // Calculate two vectors cross product
-RMAPI Vector3 Cross(Vector3 v1, Vector3 v2)
+RMAPI constexpr Vector3 Cross(Vector3 v1, Vector3 v2)
 {
     Vector3 result = { v1.y * v2.z - v1.z * v2.y, v1.z * v2.x - v1.x * v2.z, v1.x * v2.y - v1.y * v2.x };
 
@@ -699,21 +995,21 @@ RMAPI Vector3 Cross(Vector3 v1, Vector3 v2)
 }
 
 // Calculate one vector perpendicular vector
-RMAPI Vector3 Perpendicular(Vector3 v)
+RMAPI constexpr Vector3 Perpendicular(Vector3 v)
 {
     Vector3 result = { 0 };
 
-    float min = (float)fabs(v.x);
+    float min = Abs(v.x);
     Vector3 cardinalAxis = { 1.0f, 0.0f, 0.0f };
 
-    if (fabsf(v.y) < min)
+    if (Abs(v.y) < min)
     {
-        min = (float)fabs(v.y);
+        min = Abs(v.y);
         Vector3 tmp = { 0.0f, 1.0f, 0.0f };
         cardinalAxis = tmp;
     }
 
-    if (fabsf(v.z) < min)
+    if (Abs(v.z) < min)
     {
         Vector3 tmp = { 0.0f, 0.0f, 1.0f };
         cardinalAxis = tmp;
@@ -728,15 +1024,15 @@ RMAPI Vector3 Perpendicular(Vector3 v)
 }
 
 // Calculate vector length
-RMAPI float Length(const Vector3 v)
+RMAPI constexpr float Length(const Vector3 v)
 {
-    float result = sqrtf(v.x * v.x + v.y * v.y + v.z * v.z);
+    float result = Sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
 
     return result;
 }
 
 // Calculate vector square length
-RMAPI float LengthSqr(const Vector3 v)
+RMAPI constexpr float LengthSqr(const Vector3 v)
 {
     float result = v.x * v.x + v.y * v.y + v.z * v.z;
 
@@ -744,7 +1040,7 @@ RMAPI float LengthSqr(const Vector3 v)
 }
 
 // Calculate two vectors dot product
-RMAPI float Dot(Vector3 v1, Vector3 v2)
+RMAPI constexpr float Dot(Vector3 v1, Vector3 v2)
 {
     float result = (v1.x * v2.x + v1.y * v2.y + v1.z * v2.z);
 
@@ -752,20 +1048,20 @@ RMAPI float Dot(Vector3 v1, Vector3 v2)
 }
 
 // Calculate distance between two vectors
-RMAPI float Distance(Vector3 v1, Vector3 v2)
+RMAPI constexpr float Distance(Vector3 v1, Vector3 v2)
 {
     float result = 0.0f;
 
     float dx = v2.x - v1.x;
     float dy = v2.y - v1.y;
     float dz = v2.z - v1.z;
-    result = sqrtf(dx * dx + dy * dy + dz * dz);
+    result = Sqrt(dx * dx + dy * dy + dz * dz);
 
     return result;
 }
 
 // Calculate square distance between two vectors
-RMAPI float DistanceSqr(Vector3 v1, Vector3 v2)
+RMAPI constexpr float DistanceSqr(Vector3 v1, Vector3 v2)
 {
     float result = 0.0f;
 
@@ -778,21 +1074,21 @@ RMAPI float DistanceSqr(Vector3 v1, Vector3 v2)
 }
 
 // Project v1 onto v2
-RMAPI Vector3 Project(Vector3 v1, Vector3 v2)
+RMAPI constexpr Vector3 Project(Vector3 v1, Vector3 v2)
 {
     float t = Dot(v1, v2) / Dot(v2, v2);
     return { t * v2.x, t * v2.y, t * v2.z };
 }
 
 // Scalar projection of v1 onto v2
-RMAPI float ProjectScalar(Vector3 v1, Vector3 v2)
+RMAPI constexpr float ProjectScalar(Vector3 v1, Vector3 v2)
 {
     float t = Dot(v1, v2) / Dot(v2, v2);
     return t;
 }
 
 // Returns the point on line AB nearest to point P
-RMAPI Vector3 ProjectPointLine(Vector3 A, Vector3 B, Vector3 P)
+RMAPI constexpr Vector3 ProjectPointLine(Vector3 A, Vector3 B, Vector3 P)
 {
     Vector3 AB = Subtract(B, A);
     float t = Dot(Subtract(P, A), AB) / Dot(AB, AB);
@@ -800,20 +1096,20 @@ RMAPI Vector3 ProjectPointLine(Vector3 A, Vector3 B, Vector3 P)
 }
 
 // Calculate angle between two vectors
-RMAPI float Angle(Vector3 v1, Vector3 v2)
+RMAPI constexpr float Angle(Vector3 v1, Vector3 v2)
 {
     float result = 0.0f;
 
     Vector3 cross = { v1.y * v2.z - v1.z * v2.y, v1.z * v2.x - v1.x * v2.z, v1.x * v2.y - v1.y * v2.x };
-    float len = sqrtf(cross.x * cross.x + cross.y * cross.y + cross.z * cross.z);
+    float len = Sqrt(cross.x * cross.x + cross.y * cross.y + cross.z * cross.z);
     float dot = (v1.x * v2.x + v1.y * v2.y + v1.z * v2.z);
-    result = atan2f(len, dot);
+    result = Atan2(len, dot);
 
     return result;
 }
 
 // Negate provided vector (invert direction)
-RMAPI Vector3 Negate(Vector3 v)
+RMAPI constexpr Vector3 Negate(Vector3 v)
 {
     Vector3 result = { -v.x, -v.y, -v.z };
 
@@ -821,7 +1117,7 @@ RMAPI Vector3 Negate(Vector3 v)
 }
 
 // Divide vector by vector
-RMAPI Vector3 Divide(Vector3 v1, Vector3 v2)
+RMAPI constexpr Vector3 Divide(Vector3 v1, Vector3 v2)
 {
     Vector3 result = { v1.x / v2.x, v1.y / v2.y, v1.z / v2.z };
 
@@ -829,11 +1125,11 @@ RMAPI Vector3 Divide(Vector3 v1, Vector3 v2)
 }
 
 // Normalize provided vector
-RMAPI Vector3 Normalize(Vector3 v)
+RMAPI constexpr Vector3 Normalize(Vector3 v)
 {
     Vector3 result = v;
 
-    float length = sqrtf(v.x * v.x + v.y * v.y + v.z * v.z);
+    float length = Sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
     if (length == 0.0f) length = 1.0f;
     float ilength = 1.0f / length;
 
@@ -847,14 +1143,14 @@ RMAPI Vector3 Normalize(Vector3 v)
 // Orthonormalize provided vectors
 // Makes vectors normalized and orthogonal to each other
 // Gram-Schmidt function implementation
-RMAPI void OrthoNormalize(Vector3* v1, Vector3* v2)
+RMAPI constexpr void OrthoNormalize(Vector3* v1, Vector3* v2)
 {
     float length = 0.0f;
     float ilength = 0.0f;
 
     // Vector3Normalize(*v1);
     Vector3 v = *v1;
-    length = sqrtf(v.x * v.x + v.y * v.y + v.z * v.z);
+    length = Sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
     if (length == 0.0f) length = 1.0f;
     ilength = 1.0f / length;
     v1->x *= ilength;
@@ -866,7 +1162,7 @@ RMAPI void OrthoNormalize(Vector3* v1, Vector3* v2)
 
     // Vector3Normalize(vn1);
     v = vn1;
-    length = sqrtf(v.x * v.x + v.y * v.y + v.z * v.z);
+    length = Sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
     if (length == 0.0f) length = 1.0f;
     ilength = 1.0f / length;
     vn1.x *= ilength;
@@ -880,7 +1176,7 @@ RMAPI void OrthoNormalize(Vector3* v1, Vector3* v2)
 }
 
 // Transforms a Vector3 by a given Matrix
-RMAPI Vector3 Multiply(Vector3 v, Matrix mat)
+RMAPI constexpr Vector3 Multiply(Vector3 v, Matrix mat)
 {
     Vector3 result = { 0 };
 
@@ -896,7 +1192,7 @@ RMAPI Vector3 Multiply(Vector3 v, Matrix mat)
 }
 
 // Transform a vector by quaternion rotation
-RMAPI Vector3 Rotate(Vector3 v, Quaternion q)
+RMAPI constexpr Vector3 Rotate(Vector3 v, Quaternion q)
 {
     Vector3 result = { 0 };
 
@@ -908,7 +1204,7 @@ RMAPI Vector3 Rotate(Vector3 v, Quaternion q)
 }
 
 // Rotates a vector around an axis
-RMAPI Vector3 Rotate(Vector3 v, Vector3 axis, float angle)
+RMAPI constexpr Vector3 Rotate(Vector3 v, Vector3 axis, float angle)
 {
     // Using Euler-Rodrigues Formula
     // Ref.: https://en.wikipedia.org/w/index.php?title=Euler%E2%80%93Rodrigues_formula
@@ -916,7 +1212,7 @@ RMAPI Vector3 Rotate(Vector3 v, Vector3 axis, float angle)
     Vector3 result = v;
 
     // Vector3Normalize(axis);
-    float length = sqrtf(axis.x * axis.x + axis.y * axis.y + axis.z * axis.z);
+    float length = Sqrt(axis.x * axis.x + axis.y * axis.y + axis.z * axis.z);
     if (length == 0.0f) length = 1.0f;
     float ilength = 1.0f / length;
     axis.x *= ilength;
@@ -924,11 +1220,11 @@ RMAPI Vector3 Rotate(Vector3 v, Vector3 axis, float angle)
     axis.z *= ilength;
 
     angle /= 2.0f;
-    float a = sinf(angle);
+    float a = Sin(angle);
     float b = axis.x * a;
     float c = axis.y * a;
     float d = axis.z * a;
-    a = cosf(angle);
+    a = Cos(angle);
     Vector3 w = { b, c, d };
 
     // Vector3CrossProduct(w, v)
@@ -960,7 +1256,7 @@ RMAPI Vector3 Rotate(Vector3 v, Vector3 axis, float angle)
 }
 
 // Calculate linear interpolation between two vectors
-RMAPI Vector3 Lerp(Vector3 v1, Vector3 v2, float amount)
+RMAPI constexpr Vector3 Lerp(Vector3 v1, Vector3 v2, float amount)
 {
     Vector3 result = { 0 };
 
@@ -972,13 +1268,13 @@ RMAPI Vector3 Lerp(Vector3 v1, Vector3 v2, float amount)
 }
 
 // 3d tri-linear interpolation
-RMAPI Vector3 Terp(Vector3 A, Vector3 B, Vector3 C, Vector3 t)
+RMAPI constexpr Vector3 Terp(Vector3 A, Vector3 B, Vector3 C, Vector3 t)
 {
     return A * t.x + B * t.y + C * t.z;
 }
 
 // Calculate reflected vector to normal
-RMAPI Vector3 Reflect(Vector3 v, Vector3 normal)
+RMAPI constexpr Vector3 Reflect(Vector3 v, Vector3 normal)
 {
     Vector3 result = { 0 };
 
@@ -996,32 +1292,32 @@ RMAPI Vector3 Reflect(Vector3 v, Vector3 normal)
 }
 
 // Get min value for each pair of components
-RMAPI Vector3 Min(Vector3 v1, Vector3 v2)
+RMAPI constexpr Vector3 Min(Vector3 v1, Vector3 v2)
 {
     Vector3 result = { 0 };
 
-    result.x = fminf(v1.x, v2.x);
-    result.y = fminf(v1.y, v2.y);
-    result.z = fminf(v1.z, v2.z);
+    result.x = Min(v1.x, v2.x);
+    result.y = Min(v1.y, v2.y);
+    result.z = Min(v1.z, v2.z);
 
     return result;
 }
 
 // Get max value for each pair of components
-RMAPI Vector3 Max(Vector3 v1, Vector3 v2)
+RMAPI constexpr Vector3 Max(Vector3 v1, Vector3 v2)
 {
     Vector3 result = { 0 };
 
-    result.x = fmaxf(v1.x, v2.x);
-    result.y = fmaxf(v1.y, v2.y);
-    result.z = fmaxf(v1.z, v2.z);
+    result.x = Max(v1.x, v2.x);
+    result.y = Max(v1.y, v2.y);
+    result.z = Max(v1.z, v2.z);
 
     return result;
 }
 
 // Compute barycenter coordinates (u, v, w) for point p with respect to triangle (a, b, c)
 // NOTE: Assumes P is on the plane of the triangle
-RMAPI Vector3 Barycenter(Vector3 p, Vector3 a, Vector3 b, Vector3 c)
+RMAPI constexpr Vector3 Barycenter(Vector3 p, Vector3 a, Vector3 b, Vector3 c)
 {
     Vector3 result = { 0 };
 
@@ -1045,7 +1341,7 @@ RMAPI Vector3 Barycenter(Vector3 p, Vector3 a, Vector3 b, Vector3 c)
 
 // Projects a Vector3 from screen space into object space
 // NOTE: We are avoiding calling other raymath functions despite available
-RMAPI Vector3 Unproject(Vector3 source, Matrix projection, Matrix view)
+RMAPI constexpr Vector3 Unproject(Vector3 source, Matrix projection, Matrix view)
 {
     Vector3 result = { 0 };
 
@@ -1128,7 +1424,7 @@ RMAPI Vector3 Unproject(Vector3 source, Matrix projection, Matrix view)
 }
 
 // Invert the given vector
-RMAPI Vector3 Invert(Vector3 v)
+RMAPI constexpr Vector3 Invert(Vector3 v)
 {
     Vector3 result = { 1.0f / v.x, 1.0f / v.y, 1.0f / v.z };
 
@@ -1137,26 +1433,26 @@ RMAPI Vector3 Invert(Vector3 v)
 
 // Clamp the components of the vector between
 // min and max values specified by the given vectors
-RMAPI Vector3 Clamp(Vector3 v, Vector3 min, Vector3 max)
+RMAPI constexpr Vector3 Clamp(Vector3 v, Vector3 min, Vector3 max)
 {
     Vector3 result = { 0 };
 
-    result.x = fminf(max.x, fmaxf(min.x, v.x));
-    result.y = fminf(max.y, fmaxf(min.y, v.y));
-    result.z = fminf(max.z, fmaxf(min.z, v.z));
+    result.x = Min(max.x, Max(min.x, v.x));
+    result.y = Min(max.y, Max(min.y, v.y));
+    result.z = Min(max.z, Max(min.z, v.z));
 
     return result;
 }
 
 // Clamp the magnitude of the vector between two values
-RMAPI Vector3 Clamp(Vector3 v, float min, float max)
+RMAPI constexpr Vector3 Clamp(Vector3 v, float min, float max)
 {
     Vector3 result = v;
 
     float length = (v.x * v.x) + (v.y * v.y) + (v.z * v.z);
     if (length > 0.0f)
     {
-        length = sqrtf(length);
+        length = Sqrt(length);
 
         if (length < min)
         {
@@ -1178,11 +1474,11 @@ RMAPI Vector3 Clamp(Vector3 v, float min, float max)
 }
 
 // Check whether two given vectors are almost equal
-RMAPI int Equals(Vector3 p, Vector3 q)
+RMAPI constexpr int Equals(Vector3 p, Vector3 q)
 {
-    int result = ((fabsf(p.x - q.x)) <= (EPSILON * fmaxf(1.0f, fmaxf(fabsf(p.x), fabsf(q.x))))) &&
-        ((fabsf(p.y - q.y)) <= (EPSILON * fmaxf(1.0f, fmaxf(fabsf(p.y), fabsf(q.y))))) &&
-        ((fabsf(p.z - q.z)) <= (EPSILON * fmaxf(1.0f, fmaxf(fabsf(p.z), fabsf(q.z)))));
+    int result = ((Abs(p.x - q.x)) <= (EPSILON * Max(1.0f, Max(Abs(p.x), Abs(q.x))))) &&
+        ((Abs(p.y - q.y)) <= (EPSILON * Max(1.0f, Max(Abs(p.y), Abs(q.y))))) &&
+        ((Abs(p.z - q.z)) <= (EPSILON * Max(1.0f, Max(Abs(p.z), Abs(q.z)))));
 
     return result;
 }
@@ -1193,7 +1489,7 @@ RMAPI int Equals(Vector3 p, Vector3 q)
 // and r specifies the ratio of the refractive index of the medium
 // from where the ray comes to the refractive index of the medium
 // on the other side of the surface
-RMAPI Vector3 Refract(Vector3 v, Vector3 n, float r)
+RMAPI constexpr Vector3 Refract(Vector3 v, Vector3 n, float r)
 {
     Vector3 result = { 0 };
 
@@ -1202,7 +1498,7 @@ RMAPI Vector3 Refract(Vector3 v, Vector3 n, float r)
 
     if (d >= 0.0f)
     {
-        d = sqrtf(d);
+        d = Sqrt(d);
         v.x = r * v.x - (r * dot + d) * n.x;
         v.y = r * v.y - (r * dot + d) * n.y;
         v.z = r * v.z - (r * dot + d) * n.z;
@@ -1218,7 +1514,7 @@ RMAPI Vector3 Refract(Vector3 v, Vector3 n, float r)
 //----------------------------------------------------------------------------------
 
 // Compute matrix determinant
-RMAPI float Determinant(Matrix mat)
+RMAPI constexpr float Determinant(Matrix mat)
 {
     float result = 0.0f;
 
@@ -1239,15 +1535,15 @@ RMAPI float Determinant(Matrix mat)
 }
 
 // Get the trace of the matrix (sum of the values along the diagonal)
-RMAPI float Trace(Matrix mat)
+RMAPI constexpr float Trace(Matrix mat)
 {
     float result = (mat.m0 + mat.m5 + mat.m10 + mat.m15);
 
     return result;
 }
 
-// Transposes provided matrix
-RMAPI Matrix Transpose(Matrix mat)
+// Transposes provided matrix (scalar reference path)
+RMAPI constexpr Matrix TransposeScalar(Matrix mat)
 {
     Matrix result = { 0 };
 
@@ -1271,8 +1567,51 @@ RMAPI Matrix Transpose(Matrix mat)
     return result;
 }
 
-// Invert provided matrix
-RMAPI Matrix Invert(Matrix mat)
+// Transposes provided matrix (SIMD path, falls back to scalar)
+RMAPI Matrix TransposeSimd(Matrix mat)
+{
+#if defined(MATH_SSE)
+    Matrix result;
+    const float* m = &mat.m0;
+    float* r = &result.m0;
+
+    __m128 row0 = _mm_loadu_ps(m + 0);
+    __m128 row1 = _mm_loadu_ps(m + 4);
+    __m128 row2 = _mm_loadu_ps(m + 8);
+    __m128 row3 = _mm_loadu_ps(m + 12);
+    _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+    _mm_storeu_ps(r + 0, row0);
+    _mm_storeu_ps(r + 4, row1);
+    _mm_storeu_ps(r + 8, row2);
+    _mm_storeu_ps(r + 12, row3);
+
+    return result;
+#elif defined(MATH_NEON)
+    Matrix result;
+    float* r = &result.m0;
+
+    // De-interleaving load is a transpose
+    float32x4x4_t cols = vld4q_f32(&mat.m0);
+    vst1q_f32(r + 0, cols.val[0]);
+    vst1q_f32(r + 4, cols.val[1]);
+    vst1q_f32(r + 8, cols.val[2]);
+    vst1q_f32(r + 12, cols.val[3]);
+
+    return result;
+#else
+    return TransposeScalar(mat);
+#endif
+}
+
+// Transposes provided matrix
+RMAPI constexpr Matrix Transpose(Matrix mat)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) return TransposeScalar(mat);
+    return TransposeSimd(mat);
+}
+
+// Invert provided matrix (scalar reference path)
+RMAPI constexpr Matrix InvertScalar(Matrix mat)
 {
     Matrix result = { 0 };
 
@@ -1318,8 +1657,101 @@ RMAPI Matrix Invert(Matrix mat)
     return result;
 }
 
+#if defined(MATH_SSE)
+// 2x2 row-major matrix multiply A * B (each __m128 is a 2x2 matrix)
+RMAPI __m128 Mat2Mul(__m128 a, __m128 b)
+{
+    return _mm_add_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, MATH_SHUFFLE(0, 3, 0, 3))),
+        _mm_mul_ps(_mm_shuffle_ps(a, a, MATH_SHUFFLE(1, 0, 3, 2)), _mm_shuffle_ps(b, b, MATH_SHUFFLE(2, 1, 2, 1))));
+}
+
+// 2x2 row-major matrix adjugate multiply adj(A) * B
+RMAPI __m128 Mat2AdjMul(__m128 a, __m128 b)
+{
+    return _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(a, a, MATH_SHUFFLE(3, 3, 0, 0)), b),
+        _mm_mul_ps(_mm_shuffle_ps(a, a, MATH_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(b, b, MATH_SHUFFLE(2, 3, 0, 1))));
+}
+
+// 2x2 row-major matrix multiply adjugate A * adj(B)
+RMAPI __m128 Mat2MulAdj(__m128 a, __m128 b)
+{
+    return _mm_sub_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, MATH_SHUFFLE(3, 0, 3, 0))),
+        _mm_mul_ps(_mm_shuffle_ps(a, a, MATH_SHUFFLE(1, 0, 3, 2)), _mm_shuffle_ps(b, b, MATH_SHUFFLE(2, 1, 2, 1))));
+}
+#endif
+
+// Invert provided matrix (SIMD path, falls back to scalar)
+RMAPI Matrix InvertSimd(Matrix mat)
+{
+#if defined(MATH_SSE)
+    // Block-wise inverse: the matrix is split into four 2x2 blocks
+    // | A B |
+    // | C D |
+    // so the inverse only needs 2x2 adjugates, which map onto a single register each.
+    Matrix result;
+    const float* m = &mat.m0;
+    float* r = &result.m0;
+
+    __m128 row0 = _mm_loadu_ps(m + 0);
+    __m128 row1 = _mm_loadu_ps(m + 4);
+    __m128 row2 = _mm_loadu_ps(m + 8);
+    __m128 row3 = _mm_loadu_ps(m + 12);
+
+    __m128 A = _mm_movelh_ps(row0, row1);
+    __m128 B = _mm_movehl_ps(row1, row0);
+    __m128 C = _mm_movelh_ps(row2, row3);
+    __m128 D = _mm_movehl_ps(row3, row2);
+
+    // Sub-determinants (|A|, |B|, |C|, |D|)
+    __m128 detSub = _mm_sub_ps(
+        _mm_mul_ps(_mm_shuffle_ps(row0, row2, MATH_SHUFFLE(0, 2, 0, 2)), _mm_shuffle_ps(row1, row3, MATH_SHUFFLE(1, 3, 1, 3))),
+        _mm_mul_ps(_mm_shuffle_ps(row0, row2, MATH_SHUFFLE(1, 3, 1, 3)), _mm_shuffle_ps(row1, row3, MATH_SHUFFLE(0, 2, 0, 2))));
+    __m128 detA = _mm_shuffle_ps(detSub, detSub, MATH_SHUFFLE(0, 0, 0, 0));
+    __m128 detB = _mm_shuffle_ps(detSub, detSub, MATH_SHUFFLE(1, 1, 1, 1));
+    __m128 detC = _mm_shuffle_ps(detSub, detSub, MATH_SHUFFLE(2, 2, 2, 2));
+    __m128 detD = _mm_shuffle_ps(detSub, detSub, MATH_SHUFFLE(3, 3, 3, 3));
+
+    __m128 DC = Mat2AdjMul(D, C);
+    __m128 AB = Mat2AdjMul(A, B);
+    __m128 X = _mm_sub_ps(_mm_mul_ps(detD, A), Mat2Mul(B, DC));
+    __m128 W = _mm_sub_ps(_mm_mul_ps(detA, D), Mat2Mul(C, AB));
+    __m128 Y = _mm_sub_ps(_mm_mul_ps(detB, C), Mat2MulAdj(D, AB));
+    __m128 Z = _mm_sub_ps(_mm_mul_ps(detC, B), Mat2MulAdj(A, DC));
+
+    // |M| = |A||D| + |B||C| - tr(adj(A)B * adj(D)C)
+    __m128 tr = _mm_mul_ps(AB, _mm_shuffle_ps(DC, DC, MATH_SHUFFLE(0, 2, 1, 3)));
+    tr = _mm_add_ps(tr, _mm_shuffle_ps(tr, tr, MATH_SHUFFLE(1, 0, 3, 2)));
+    tr = _mm_add_ps(tr, _mm_shuffle_ps(tr, tr, MATH_SHUFFLE(2, 3, 0, 1)));
+    __m128 detM = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), tr);
+
+    __m128 invDetM = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), detM);
+    X = _mm_mul_ps(X, invDetM);
+    Y = _mm_mul_ps(Y, invDetM);
+    Z = _mm_mul_ps(Z, invDetM);
+    W = _mm_mul_ps(W, invDetM);
+
+    // Apply the final adjugate swizzle while re-assembling the rows
+    _mm_storeu_ps(r + 0, _mm_shuffle_ps(X, Y, MATH_SHUFFLE(3, 1, 3, 1)));
+    _mm_storeu_ps(r + 4, _mm_shuffle_ps(X, Y, MATH_SHUFFLE(2, 0, 2, 0)));
+    _mm_storeu_ps(r + 8, _mm_shuffle_ps(Z, W, MATH_SHUFFLE(3, 1, 3, 1)));
+    _mm_storeu_ps(r + 12, _mm_shuffle_ps(Z, W, MATH_SHUFFLE(2, 0, 2, 0)));
+
+    return result;
+#else
+    // NEON uses the scalar path until it has its own block-wise kernel
+    return InvertScalar(mat);
+#endif
+}
+
+// Invert provided matrix
+RMAPI constexpr Matrix Invert(Matrix mat)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) return InvertScalar(mat);
+    return InvertSimd(mat);
+}
+
 // Get identity matrix
-RMAPI Matrix MatrixIdentity(void)
+RMAPI constexpr Matrix MatrixIdentity(void)
 {
     Matrix result = { 1.0f, 0.0f, 0.0f, 0.0f,
                       0.0f, 1.0f, 0.0f, 0.0f,
@@ -1330,7 +1762,7 @@ RMAPI Matrix MatrixIdentity(void)
 }
 
 // Add two matrices
-RMAPI Matrix Add(Matrix left, Matrix right)
+RMAPI constexpr Matrix Add(Matrix left, Matrix right)
 {
     Matrix result = { 0 };
 
@@ -1355,7 +1787,7 @@ RMAPI Matrix Add(Matrix left, Matrix right)
 }
 
 // Subtract two matrices (left - right)
-RMAPI Matrix Subtract(Matrix left, Matrix right)
+RMAPI constexpr Matrix Subtract(Matrix left, Matrix right)
 {
     Matrix result = { 0 };
 
@@ -1379,9 +1811,9 @@ RMAPI Matrix Subtract(Matrix left, Matrix right)
     return result;
 }
 
-// Get two matrix multiplication
+// Get two matrix multiplication (scalar reference path)
 // NOTE: When multiplying matrices... the order matters!
-RMAPI Matrix Multiply(Matrix left, Matrix right)
+RMAPI constexpr Matrix MultiplyScalar(Matrix left, Matrix right)
 {
     Matrix result = { 0 };
 
@@ -1405,8 +1837,92 @@ RMAPI Matrix Multiply(Matrix left, Matrix right)
     return result;
 }
 
+// Get two matrix multiplication (SIMD path, falls back to scalar)
+// Each result row is a linear combination of left's rows weighted by right's row,
+// so it sums in the same order as MultiplyScalar (results are bit-identical without FMA).
+RMAPI Matrix MultiplySimd(Matrix left, Matrix right)
+{
+#if defined(MATH_AVX)
+    Matrix result;
+    const float* l = &left.m0;
+    const float* r = &right.m0;
+    float* o = &result.m0;
+
+    __m256 l0 = _mm256_broadcast_ps((const __m128*)(l + 0));
+    __m256 l1 = _mm256_broadcast_ps((const __m128*)(l + 4));
+    __m256 l2 = _mm256_broadcast_ps((const __m128*)(l + 8));
+    __m256 l3 = _mm256_broadcast_ps((const __m128*)(l + 12));
+
+    // Two rows per iteration
+    for (int i = 0; i < 16; i += 8)
+    {
+        __m256 rr = _mm256_loadu_ps(r + i);
+        __m256 row = _mm256_mul_ps(_mm256_shuffle_ps(rr, rr, MATH_SHUFFLE(0, 0, 0, 0)), l0);
+        row = _mm256_add_ps(row, _mm256_mul_ps(_mm256_shuffle_ps(rr, rr, MATH_SHUFFLE(1, 1, 1, 1)), l1));
+        row = _mm256_add_ps(row, _mm256_mul_ps(_mm256_shuffle_ps(rr, rr, MATH_SHUFFLE(2, 2, 2, 2)), l2));
+        row = _mm256_add_ps(row, _mm256_mul_ps(_mm256_shuffle_ps(rr, rr, MATH_SHUFFLE(3, 3, 3, 3)), l3));
+        _mm256_storeu_ps(o + i, row);
+    }
+
+    return result;
+#elif defined(MATH_SSE)
+    Matrix result;
+    const float* l = &left.m0;
+    const float* r = &right.m0;
+    float* o = &result.m0;
+
+    __m128 l0 = _mm_loadu_ps(l + 0);
+    __m128 l1 = _mm_loadu_ps(l + 4);
+    __m128 l2 = _mm_loadu_ps(l + 8);
+    __m128 l3 = _mm_loadu_ps(l + 12);
+
+    for (int i = 0; i < 16; i += 4)
+    {
+        __m128 rr = _mm_loadu_ps(r + i);
+        __m128 row = _mm_mul_ps(_mm_shuffle_ps(rr, rr, MATH_SHUFFLE(0, 0, 0, 0)), l0);
+        row = _mm_add_ps(row, _mm_mul_ps(_mm_shuffle_ps(rr, rr, MATH_SHUFFLE(1, 1, 1, 1)), l1));
+        row = _mm_add_ps(row, _mm_mul_ps(_mm_shuffle_ps(rr, rr, MATH_SHUFFLE(2, 2, 2, 2)), l2));
+        row = _mm_add_ps(row, _mm_mul_ps(_mm_shuffle_ps(rr, rr, MATH_SHUFFLE(3, 3, 3, 3)), l3));
+        _mm_storeu_ps(o + i, row);
+    }
+
+    return result;
+#elif defined(MATH_NEON)
+    Matrix result;
+    const float* l = &left.m0;
+    const float* r = &right.m0;
+    float* o = &result.m0;
+
+    float32x4_t l0 = vld1q_f32(l + 0);
+    float32x4_t l1 = vld1q_f32(l + 4);
+    float32x4_t l2 = vld1q_f32(l + 8);
+    float32x4_t l3 = vld1q_f32(l + 12);
+
+    for (int i = 0; i < 16; i += 4)
+    {
+        float32x4_t row = vmulq_n_f32(l0, r[i + 0]);
+        row = vaddq_f32(row, vmulq_n_f32(l1, r[i + 1]));
+        row = vaddq_f32(row, vmulq_n_f32(l2, r[i + 2]));
+        row = vaddq_f32(row, vmulq_n_f32(l3, r[i + 3]));
+        vst1q_f32(o + i, row);
+    }
+
+    return result;
+#else
+    return MultiplyScalar(left, right);
+#endif
+}
+
+// Get two matrix multiplication
+// NOTE: When multiplying matrices... the order matters!
+RMAPI constexpr Matrix Multiply(Matrix left, Matrix right)
+{
+    if (MATH_IS_CONSTANT_EVALUATED()) return MultiplyScalar(left, right);
+    return MultiplySimd(left, right);
+}
+
 // Get translation matrix
-RMAPI Matrix Translate(float x, float y, float z)
+RMAPI constexpr Matrix Translate(float x, float y, float z)
 {
     Matrix result = { 1.0f, 0.0f, 0.0f, x,
                       0.0f, 1.0f, 0.0f, y,
@@ -1418,7 +1934,7 @@ RMAPI Matrix Translate(float x, float y, float z)
 
 // Create rotation matrix from axis and angle
 // NOTE: Angle should be provided in radians
-RMAPI Matrix Rotate(Vector3 axis, float angle)
+RMAPI constexpr Matrix Rotate(Vector3 axis, float angle)
 {
     Matrix result = { 0 };
 
@@ -1428,14 +1944,14 @@ RMAPI Matrix Rotate(Vector3 axis, float angle)
 
     if ((lengthSquared != 1.0f) && (lengthSquared != 0.0f))
     {
-        float ilength = 1.0f / sqrtf(lengthSquared);
+        float ilength = 1.0f / Sqrt(lengthSquared);
         x *= ilength;
         y *= ilength;
         z *= ilength;
     }
 
-    float sinres = sinf(angle);
-    float cosres = cosf(angle);
+    float sinres = Sin(angle);
+    float cosres = Cos(angle);
     float t = 1.0f - cosres;
 
     result.m0 = x * x * t + cosres;
@@ -1463,15 +1979,15 @@ RMAPI Matrix Rotate(Vector3 axis, float angle)
 
 // Get x-rotation matrix
 // NOTE: Angle must be provided in radians
-RMAPI Matrix RotateX(float angle)
+RMAPI constexpr Matrix RotateX(float angle)
 {
     Matrix result = { 1.0f, 0.0f, 0.0f, 0.0f,
                       0.0f, 1.0f, 0.0f, 0.0f,
                       0.0f, 0.0f, 1.0f, 0.0f,
                       0.0f, 0.0f, 0.0f, 1.0f }; // MatrixIdentity()
 
-    float cosres = cosf(angle);
-    float sinres = sinf(angle);
+    float cosres = Cos(angle);
+    float sinres = Sin(angle);
 
     result.m5 = cosres;
     result.m6 = sinres;
@@ -1483,15 +1999,15 @@ RMAPI Matrix RotateX(float angle)
 
 // Get y-rotation matrix
 // NOTE: Angle must be provided in radians
-RMAPI Matrix RotateY(float angle)
+RMAPI constexpr Matrix RotateY(float angle)
 {
     Matrix result = { 1.0f, 0.0f, 0.0f, 0.0f,
                       0.0f, 1.0f, 0.0f, 0.0f,
                       0.0f, 0.0f, 1.0f, 0.0f,
                       0.0f, 0.0f, 0.0f, 1.0f }; // MatrixIdentity()
 
-    float cosres = cosf(angle);
-    float sinres = sinf(angle);
+    float cosres = Cos(angle);
+    float sinres = Sin(angle);
 
     result.m0 = cosres;
     result.m2 = -sinres;
@@ -1503,15 +2019,15 @@ RMAPI Matrix RotateY(float angle)
 
 // Get z-rotation matrix
 // NOTE: Angle must be provided in radians
-RMAPI Matrix RotateZ(float angle)
+RMAPI constexpr Matrix RotateZ(float angle)
 {
     Matrix result = { 1.0f, 0.0f, 0.0f, 0.0f,
                       0.0f, 1.0f, 0.0f, 0.0f,
                       0.0f, 0.0f, 1.0f, 0.0f,
                       0.0f, 0.0f, 0.0f, 1.0f }; // MatrixIdentity()
 
-    float cosres = cosf(angle);
-    float sinres = sinf(angle);
+    float cosres = Cos(angle);
+    float sinres = Sin(angle);
 
     result.m0 = cosres;
     result.m1 = sinres;
@@ -1524,19 +2040,19 @@ RMAPI Matrix RotateZ(float angle)
 
 // Get xyz-rotation matrix
 // NOTE: Angle must be provided in radians
-RMAPI Matrix RotateXYZ(Vector3 angle)
+RMAPI constexpr Matrix RotateXYZ(Vector3 angle)
 {
     Matrix result = { 1.0f, 0.0f, 0.0f, 0.0f,
                       0.0f, 1.0f, 0.0f, 0.0f,
                       0.0f, 0.0f, 1.0f, 0.0f,
                       0.0f, 0.0f, 0.0f, 1.0f }; // MatrixIdentity()
 
-    float cosz = cosf(-angle.z);
-    float sinz = sinf(-angle.z);
-    float cosy = cosf(-angle.y);
-    float siny = sinf(-angle.y);
-    float cosx = cosf(-angle.x);
-    float sinx = sinf(-angle.x);
+    float cosz = Cos(-angle.z);
+    float sinz = Sin(-angle.z);
+    float cosy = Cos(-angle.y);
+    float siny = Sin(-angle.y);
+    float cosx = Cos(-angle.x);
+    float sinx = Sin(-angle.x);
 
     result.m0 = cosz * cosy;
     result.m1 = (cosz * siny * sinx) - (sinz * cosx);
@@ -1555,16 +2071,16 @@ RMAPI Matrix RotateXYZ(Vector3 angle)
 
 // Get zyx-rotation matrix
 // NOTE: Angle must be provided in radians
-RMAPI Matrix RotateZYX(Vector3 angle)
+RMAPI constexpr Matrix RotateZYX(Vector3 angle)
 {
     Matrix result = { 0 };
 
-    float cz = cosf(angle.z);
-    float sz = sinf(angle.z);
-    float cy = cosf(angle.y);
-    float sy = sinf(angle.y);
-    float cx = cosf(angle.x);
-    float sx = sinf(angle.x);
+    float cz = Cos(angle.z);
+    float sz = Sin(angle.z);
+    float cy = Cos(angle.y);
+    float sy = Sin(angle.y);
+    float cx = Cos(angle.x);
+    float sx = Sin(angle.x);
 
     result.m0 = cz * cy;
     result.m4 = cz * sy * sx - cx * sz;
@@ -1590,7 +2106,7 @@ RMAPI Matrix RotateZYX(Vector3 angle)
 }
 
 // Get scaling matrix
-RMAPI Matrix Scale(float x, float y, float z)
+RMAPI constexpr Matrix Scale(float x, float y, float z)
 {
     Matrix result = { x, 0.0f, 0.0f, 0.0f,
                       0.0f, y, 0.0f, 0.0f,
@@ -1601,7 +2117,7 @@ RMAPI Matrix Scale(float x, float y, float z)
 }
 
 // Get perspective projection matrix
-RMAPI Matrix Frustum(double left, double right, double bottom, double top, double near, double far)
+RMAPI constexpr Matrix Frustum(double left, double right, double bottom, double top, double near, double far)
 {
     Matrix result = { 0 };
 
@@ -1634,11 +2150,11 @@ RMAPI Matrix Frustum(double left, double right, double bottom, double top, doubl
 
 // Get perspective projection matrix
 // NOTE: Fovy angle must be provided in radians
-RMAPI Matrix Perspective(double fovy, double aspect, double near, double far)
+RMAPI constexpr Matrix Perspective(double fovy, double aspect, double near, double far)
 {
     Matrix result = { 0 };
 
-    double top = near * tan(fovy * 0.5);
+    double top = near * Tan(fovy * 0.5);
     double bottom = -top;
     double right = top * aspect;
     double left = -right;
@@ -1660,7 +2176,7 @@ RMAPI Matrix Perspective(double fovy, double aspect, double near, double far)
 }
 
 // Get orthographic projection matrix
-RMAPI Matrix Ortho(double left, double right, double bottom, double top, double near, double far)
+RMAPI constexpr Matrix Ortho(double left, double right, double bottom, double top, double near, double far)
 {
     Matrix result = { 0 };
 
@@ -1689,7 +2205,7 @@ RMAPI Matrix Ortho(double left, double right, double bottom, double top, double
 }
 
 // Get camera look-at matrix (view matrix)
-RMAPI Matrix LookAt(Vector3 eye, Vector3 target, Vector3 up)
+RMAPI constexpr Matrix LookAt(Vector3 eye, Vector3 target, Vector3 up)
 {
     Matrix result = { 0 };
 
@@ -1701,7 +2217,7 @@ RMAPI Matrix LookAt(Vector3 eye, Vector3 target, Vector3 up)
 
     // Vector3Normalize(vz)
     Vector3 v = vz;
-    length = sqrtf(v.x * v.x + v.y * v.y + v.z * v.z);
+    length = Sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
     if (length == 0.0f) length = 1.0f;
     ilength = 1.0f / length;
     vz.x *= ilength;
@@ -1713,7 +2229,7 @@ RMAPI Matrix LookAt(Vector3 eye, Vector3 target, Vector3 up)
 
     // Vector3Normalize(x)
     v = vx;
-    length = sqrtf(v.x * v.x + v.y * v.y + v.z * v.z);
+    length = Sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
     if (length == 0.0f) length = 1.0f;
     ilength = 1.0f / length;
     vx.x *= ilength;
@@ -1744,22 +2260,16 @@ RMAPI Matrix LookAt(Vector3 eye, Vector3 target, Vector3 up)
 }
 
 // Extract rotation from world matrix
-inline Matrix NormalMatrix(Matrix world)
+// NOTE: Assumes world is affine (no projective row), uses the closed-form Transform path
+RMAPI constexpr Matrix NormalMatrix(Matrix world)
 {
-    Matrix normal = world;
-    normal.m12 = normal.m13 = normal.m14 = 0.0f;
-    normal = Transpose(Invert(normal));
-    return normal;
+    return NormalMatrix(ToTransform(world));
 }
 
 // Convert from object-space to normalized-device-coordinates
-inline Vector3 Clip(Matrix m, Vector3 v)
+RMAPI constexpr Vector3 Clip(Matrix m, Vector3 v)
 {
-    Vector4 clip;
-    clip.x = v.x;
-    clip.y = v.y;
-    clip.z = v.z;
-    clip.w = 1.0f;
+    Vector4 clip = { v.x, v.y, v.z, 1.0f };
 
     clip = m * clip;
     clip /= clip.w;
@@ -1772,7 +2282,7 @@ inline Vector3 Clip(Matrix m, Vector3 v)
 //----------------------------------------------------------------------------------
 
 // Add two quaternions
-RMAPI Quaternion Add(Quaternion q1, Quaternion q2)
+RMAPI constexpr Quaternion Add(Quaternion q1, Quaternion q2)
 {
     Quaternion result = { q1.x + q2.x, q1.y + q2.y, q1.z + q2.z, q1.w + q2.w };
 
@@ -1780,7 +2290,7 @@ RMAPI Quaternion Add(Quaternion q1, Quaternion q2)
 }
 
 // Add quaternion and float value
-RMAPI Quaternion Add(Quaternion q, float add)
+RMAPI constexpr Quaternion Add(Quaternion q, float add)
 {
     Quaternion result = { q.x + add, q.y + add, q.z + add, q.w + add };
 
@@ -1788,7 +2298,7 @@ RMAPI Quaternion Add(Quaternion q, float add)
 }
 
 // Subtract two quaternions
-RMAPI Quaternion Subtract(Quaternion q1, Quaternion q2)
+RMAPI constexpr Quaternion Subtract(Quaternion q1, Quaternion q2)
 {
     Quaternion result = { q1.x - q2.x, q1.y - q2.y, q1.z - q2.z, q1.w - q2.w };
 
@@ -1796,7 +2306,7 @@ RMAPI Quaternion Subtract(Quaternion q1, Quaternion q2)
 }
 
 // Subtract quaternion and float value
-RMAPI Quaternion Subtract(Quaternion q, float sub)
+RMAPI constexpr Quaternion Subtract(Quaternion q, float sub)
 {
     Quaternion result = { q.x - sub, q.y - sub, q.z - sub, q.w - sub };
 
@@ -1804,7 +2314,7 @@ RMAPI Quaternion Subtract(Quaternion q, float sub)
 }
 
 // Get identity quaternion
-RMAPI Quaternion QuaternionIdentity(void)
+RMAPI constexpr Quaternion QuaternionIdentity(void)
 {
     Quaternion result = { 0.0f, 0.0f, 0.0f, 1.0f };
 
@@ -1812,19 +2322,19 @@ RMAPI Quaternion QuaternionIdentity(void)
 }
 
 // Computes the length of a quaternion
-RMAPI float Length(Quaternion q)
+RMAPI constexpr float Length(Quaternion q)
 {
-    float result = sqrtf(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+    float result = Sqrt(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
 
     return result;
 }
 
 // Normalize provided quaternion
-RMAPI Quaternion Normalize(Quaternion q)
+RMAPI constexpr Quaternion Normalize(Quaternion q)
 {
     Quaternion result = { 0 };
 
-    float length = sqrtf(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+    float length = Sqrt(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
     if (length == 0.0f) length = 1.0f;
     float ilength = 1.0f / length;
 
@@ -1837,7 +2347,7 @@ RMAPI Quaternion Normalize(Quaternion q)
 }
 
 // Invert provided quaternion
-RMAPI Quaternion Invert(Quaternion q)
+RMAPI constexpr Quaternion Invert(Quaternion q)
 {
     Quaternion result = q;
 
@@ -1857,7 +2367,7 @@ RMAPI Quaternion Invert(Quaternion q)
 }
 
 // Calculate two quaternion multiplication
-RMAPI Quaternion Multiply(Quaternion q1, Quaternion q2)
+RMAPI constexpr Quaternion Multiply(Quaternion q1, Quaternion q2)
 {
     Quaternion result = { 0 };
 
@@ -1873,7 +2383,7 @@ RMAPI Quaternion Multiply(Quaternion q1, Quaternion q2)
 }
 
 // Scale quaternion by float value
-RMAPI Quaternion Scale(Quaternion q, float mul)
+RMAPI constexpr Quaternion Scale(Quaternion q, float mul)
 {
     Quaternion result = { 0 };
 
@@ -1886,7 +2396,7 @@ RMAPI Quaternion Scale(Quaternion q, float mul)
 }
 
 // Divide two quaternions
-RMAPI Quaternion Divide(Quaternion q1, Quaternion q2)
+RMAPI constexpr Quaternion Divide(Quaternion q1, Quaternion q2)
 {
     Quaternion result = { q1.x / q2.x, q1.y / q2.y, q1.z / q2.z, q1.w / q2.w };
 
@@ -1894,7 +2404,7 @@ RMAPI Quaternion Divide(Quaternion q1, Quaternion q2)
 }
 
 // Calculate linear interpolation between two quaternions
-RMAPI Quaternion Lerp(Quaternion q1, Quaternion q2, float amount)
+RMAPI constexpr Quaternion Lerp(Quaternion q1, Quaternion q2, float amount)
 {
     Quaternion result = { 0 };
 
@@ -1907,7 +2417,7 @@ RMAPI Quaternion Lerp(Quaternion q1, Quaternion q2, float amount)
 }
 
 // Calculate slerp-optimized interpolation between two quaternions
-RMAPI Quaternion Nlerp(Quaternion q1, Quaternion q2, float amount)
+RMAPI constexpr Quaternion Nlerp(Quaternion q1, Quaternion q2, float amount)
 {
     Quaternion result = { 0 };
 
@@ -1919,7 +2429,7 @@ RMAPI Quaternion Nlerp(Quaternion q1, Quaternion q2, float amount)
 
     // QuaternionNormalize(q);
     Quaternion q = result;
-    float length = sqrtf(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+    float length = Sqrt(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
     if (length == 0.0f) length = 1.0f;
     float ilength = 1.0f / length;
 
@@ -1932,7 +2442,7 @@ RMAPI Quaternion Nlerp(Quaternion q1, Quaternion q2, float amount)
 }
 
 // Calculates spherical linear interpolation between two quaternions
-RMAPI Quaternion Slerp(Quaternion q1, Quaternion q2, float amount)
+RMAPI constexpr Quaternion Slerp(Quaternion q1, Quaternion q2, float amount)
 {
     Quaternion result = { 0 };
 
@@ -1944,14 +2454,14 @@ RMAPI Quaternion Slerp(Quaternion q1, Quaternion q2, float amount)
         cosHalfTheta = -cosHalfTheta;
     }
 
-    if (fabsf(cosHalfTheta) >= 1.0f) result = q1;
+    if (Abs(cosHalfTheta) >= 1.0f) result = q1;
     else if (cosHalfTheta > 0.95f) result = Nlerp(q1, q2, amount);
     else
     {
-        float halfTheta = acosf(cosHalfTheta);
-        float sinHalfTheta = sqrtf(1.0f - cosHalfTheta * cosHalfTheta);
+        float halfTheta = Acos(cosHalfTheta);
+        float sinHalfTheta = Sqrt(1.0f - cosHalfTheta * cosHalfTheta);
 
-        if (fabsf(sinHalfTheta) < 0.001f)
+        if (Abs(sinHalfTheta) < 0.001f)
         {
             result.x = (q1.x * 0.5f + q2.x * 0.5f);
             result.y = (q1.y * 0.5f + q2.y * 0.5f);
@@ -1960,8 +2470,8 @@ RMAPI Quaternion Slerp(Quaternion q1, Quaternion q2, float amount)
         }
         else
         {
-            float ratioA = sinf((1 - amount) * halfTheta) / sinHalfTheta;
-            float ratioB = sinf(amount * halfTheta) / sinHalfTheta;
+            float ratioA = Sin((1 - amount) * halfTheta) / sinHalfTheta;
+            float ratioB = Sin(amount * halfTheta) / sinHalfTheta;
 
             result.x = (q1.x * ratioA + q2.x * ratioB);
             result.y = (q1.y * ratioA + q2.y * ratioB);
@@ -1974,7 +2484,7 @@ RMAPI Quaternion Slerp(Quaternion q1, Quaternion q2, float amount)
 }
 
 // Calculate quaternion based on the rotation from one vector to another
-RMAPI Quaternion FromTo(Vector3 from, Vector3 to)
+RMAPI constexpr Quaternion FromTo(Vector3 from, Vector3 to)
 {
     Quaternion result = { 0 };
 
@@ -1989,7 +2499,7 @@ RMAPI Quaternion FromTo(Vector3 from, Vector3 to)
     // QuaternionNormalize(q);
     // NOTE: Normalize to essentially nlerp the original and identity to 0.5
     Quaternion q = result;
-    float length = sqrtf(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+    float length = Sqrt(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
     if (length == 0.0f) length = 1.0f;
     float ilength = 1.0f / length;
 
@@ -2002,7 +2512,7 @@ RMAPI Quaternion FromTo(Vector3 from, Vector3 to)
 }
 
 // Get a quaternion for a given rotation matrix
-RMAPI Quaternion FromMatrix(Matrix mat)
+RMAPI constexpr Quaternion FromMatrix(Matrix mat)
 {
     Quaternion result = { 0 };
 
@@ -2031,7 +2541,7 @@ RMAPI Quaternion FromMatrix(Matrix mat)
         biggestIndex = 3;
     }
 
-    float biggestVal = sqrtf(fourBiggestSquaredMinus1 + 1.0f) * 0.5f;
+    float biggestVal = Sqrt(fourBiggestSquaredMinus1 + 1.0f) * 0.5f;
     float mult = 0.25f / biggestVal;
 
     switch (biggestIndex)
@@ -2066,7 +2576,7 @@ RMAPI Quaternion FromMatrix(Matrix mat)
 }
 
 // Get a matrix for a given quaternion
-RMAPI Matrix ToMatrix(Quaternion q)
+RMAPI constexpr Matrix ToMatrix(Quaternion q)
 {
     Matrix result = { 1.0f, 0.0f, 0.0f, 0.0f,
                       0.0f, 1.0f, 0.0f, 0.0f,
@@ -2100,11 +2610,11 @@ RMAPI Matrix ToMatrix(Quaternion q)
 
 // Get rotation quaternion for an angle and axis
 // NOTE: Angle must be provided in radians
-RMAPI Quaternion FromAxisAngle(Vector3 axis, float angle)
+RMAPI constexpr Quaternion FromAxisAngle(Vector3 axis, float angle)
 {
     Quaternion result = { 0.0f, 0.0f, 0.0f, 1.0f };
 
-    float axisLength = sqrtf(axis.x * axis.x + axis.y * axis.y + axis.z * axis.z);
+    float axisLength = Sqrt(axis.x * axis.x + axis.y * axis.y + axis.z * axis.z);
 
     if (axisLength != 0.0f)
     {
@@ -2115,15 +2625,15 @@ RMAPI Quaternion FromAxisAngle(Vector3 axis, float angle)
 
         // Vector3Normalize(axis)
         Vector3 v = axis;
-        length = sqrtf(v.x * v.x + v.y * v.y + v.z * v.z);
+        length = Sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
         if (length == 0.0f) length = 1.0f;
         ilength = 1.0f / length;
         axis.x *= ilength;
         axis.y *= ilength;
         axis.z *= ilength;
 
-        float sinres = sinf(angle);
-        float cosres = cosf(angle);
+        float sinres = Sin(angle);
+        float cosres = Cos(angle);
 
         result.x = axis.x * sinres;
         result.y = axis.y * sinres;
@@ -2132,7 +2642,7 @@ RMAPI Quaternion FromAxisAngle(Vector3 axis, float angle)
 
         // QuaternionNormalize(q);
         Quaternion q = result;
-        length = sqrtf(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+        length = Sqrt(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
         if (length == 0.0f) length = 1.0f;
         ilength = 1.0f / length;
         result.x = q.x * ilength;
@@ -2145,12 +2655,12 @@ RMAPI Quaternion FromAxisAngle(Vector3 axis, float angle)
 }
 
 // Get the rotation angle and axis for a given quaternion
-RMAPI void ToAxisAngle(Quaternion q, Vector3* outAxis, float* outAngle)
+RMAPI constexpr void ToAxisAngle(Quaternion q, Vector3* outAxis, float* outAngle)
 {
-    if (fabsf(q.w) > 1.0f)
+    if (Abs(q.w) > 1.0f)
     {
         // QuaternionNormalize(q);
-        float length = sqrtf(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+        float length = Sqrt(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
         if (length == 0.0f) length = 1.0f;
         float ilength = 1.0f / length;
 
@@ -2161,8 +2671,8 @@ RMAPI void ToAxisAngle(Quaternion q, Vector3* outAxis, float* outAngle)
     }
 
     Vector3 resAxis = { 0.0f, 0.0f, 0.0f };
-    float resAngle = 2.0f * acosf(q.w);
-    float den = sqrtf(1.0f - q.w * q.w);
+    float resAngle = 2.0f * Acos(q.w);
+    float den = Sqrt(1.0f - q.w * q.w);
 
     if (den > 0.0001f)
     {
@@ -2183,16 +2693,16 @@ RMAPI void ToAxisAngle(Quaternion q, Vector3* outAxis, float* outAngle)
 
 // Get the quaternion equivalent to Euler angles
 // NOTE: Rotation order is ZYX
-RMAPI Quaternion FromEuler(float pitch, float yaw, float roll)
+RMAPI constexpr Quaternion FromEuler(float pitch, float yaw, float roll)
 {
     Quaternion result = { 0 };
 
-    float x0 = cosf(pitch * 0.5f);
-    float x1 = sinf(pitch * 0.5f);
-    float y0 = cosf(yaw * 0.5f);
-    float y1 = sinf(yaw * 0.5f);
-    float z0 = cosf(roll * 0.5f);
-    float z1 = sinf(roll * 0.5f);
+    float x0 = Cos(pitch * 0.5f);
+    float x1 = Sin(pitch * 0.5f);
+    float y0 = Cos(yaw * 0.5f);
+    float y1 = Sin(yaw * 0.5f);
+    float z0 = Cos(roll * 0.5f);
+    float z1 = Sin(roll * 0.5f);
 
     result.x = x1 * y0 * z0 - x0 * y1 * z1;
     result.y = x0 * y1 * z0 + x1 * y0 * z1;
@@ -2204,31 +2714,31 @@ RMAPI Quaternion FromEuler(float pitch, float yaw, float roll)
 
 // Get the Euler angles equivalent to quaternion (roll, pitch, yaw)
 // NOTE: Angles are returned in a Vector3 struct in radians
-RMAPI Vector3 ToEuler(Quaternion q)
+RMAPI constexpr Vector3 ToEuler(Quaternion q)
 {
     Vector3 result = { 0 };
 
     // Roll (x-axis rotation)
     float x0 = 2.0f * (q.w * q.x + q.y * q.z);
     float x1 = 1.0f - 2.0f * (q.x * q.x + q.y * q.y);
-    result.x = atan2f(x0, x1);
+    result.x = Atan2(x0, x1);
 
     // Pitch (y-axis rotation)
     float y0 = 2.0f * (q.w * q.y - q.z * q.x);
     y0 = y0 > 1.0f ? 1.0f : y0;
     y0 = y0 < -1.0f ? -1.0f : y0;
-    result.y = asinf(y0);
+    result.y = Asin(y0);
 
     // Yaw (z-axis rotation)
     float z0 = 2.0f * (q.w * q.z + q.x * q.y);
     float z1 = 1.0f - 2.0f * (q.y * q.y + q.z * q.z);
-    result.z = atan2f(z0, z1);
+    result.z = Atan2(z0, z1);
 
     return result;
 }
 
 // Transform a quaternion given a transformation matrix
-RMAPI Quaternion Multiply(Quaternion q, Matrix mat)
+RMAPI constexpr Quaternion Multiply(Quaternion q, Matrix mat)
 {
     Quaternion result = { 0 };
 
@@ -2241,55 +2751,350 @@ RMAPI Quaternion Multiply(Quaternion q, Matrix mat)
 }
 
 // Check whether two given quaternions are almost equal
-RMAPI int Equals(Quaternion p, Quaternion q)
+RMAPI constexpr int Equals(Quaternion p, Quaternion q)
+{
+    int result = (((Abs(p.x - q.x)) <= (EPSILON * Max(1.0f, Max(Abs(p.x), Abs(q.x))))) &&
+        ((Abs(p.y - q.y)) <= (EPSILON * Max(1.0f, Max(Abs(p.y), Abs(q.y))))) &&
+        ((Abs(p.z - q.z)) <= (EPSILON * Max(1.0f, Max(Abs(p.z), Abs(q.z))))) &&
+        ((Abs(p.w - q.w)) <= (EPSILON * Max(1.0f, Max(Abs(p.w), Abs(q.w)))))) ||
+        (((Abs(p.x + q.x)) <= (EPSILON * Max(1.0f, Max(Abs(p.x), Abs(q.x))))) &&
+            ((Abs(p.y + q.y)) <= (EPSILON * Max(1.0f, Max(Abs(p.y), Abs(q.y))))) &&
+            ((Abs(p.z + q.z)) <= (EPSILON * Max(1.0f, Max(Abs(p.z), Abs(q.z))))) &&
+            ((Abs(p.w + q.w)) <= (EPSILON * Max(1.0f, Max(Abs(p.w), Abs(q.w))))));
+
+    return result;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Transform (affine) math
+//----------------------------------------------------------------------------------
+
+// Get identity transform
+RMAPI constexpr Transform TransformIdentity(void)
+{
+    Transform result = { 1.0f, 0.0f, 0.0f, 0.0f,
+                         0.0f, 1.0f, 0.0f, 0.0f,
+                         0.0f, 0.0f, 1.0f, 0.0f };
+
+    return result;
+}
+
+// Drop the projective row of an affine matrix
+RMAPI constexpr Transform ToTransform(Matrix mat)
+{
+    Transform result = { mat.m0, mat.m4, mat.m8, mat.m12,
+                         mat.m1, mat.m5, mat.m9, mat.m13,
+                         mat.m2, mat.m6, mat.m10, mat.m14 };
+
+    return result;
+}
+
+// Build a transform from translation, rotation and scale
+// Equivalent to Scale(scale) * ToMatrix(rotation) * Translate(translation)
+RMAPI constexpr Transform ToTransform(Vector3 translation, Quaternion rotation, Vector3 scale)
+{
+    Transform result = { 0 };
+
+    float a2 = rotation.x * rotation.x;
+    float b2 = rotation.y * rotation.y;
+    float c2 = rotation.z * rotation.z;
+    float ac = rotation.x * rotation.z;
+    float ab = rotation.x * rotation.y;
+    float bc = rotation.y * rotation.z;
+    float ad = rotation.w * rotation.x;
+    float bd = rotation.w * rotation.y;
+    float cd = rotation.w * rotation.z;
+
+    result.m0 = (1 - 2 * (b2 + c2)) * scale.x;
+    result.m1 = (2 * (ab + cd)) * scale.x;
+    result.m2 = (2 * (ac - bd)) * scale.x;
+
+    result.m4 = (2 * (ab - cd)) * scale.y;
+    result.m5 = (1 - 2 * (a2 + c2)) * scale.y;
+    result.m6 = (2 * (bc + ad)) * scale.y;
+
+    result.m8 = (2 * (ac + bd)) * scale.z;
+    result.m9 = (2 * (bc - ad)) * scale.z;
+    result.m10 = (1 - 2 * (a2 + b2)) * scale.z;
+
+    result.m12 = translation.x;
+    result.m13 = translation.y;
+    result.m14 = translation.z;
+
+    return result;
+}
+
+// Re-append the projective row (0, 0, 0, 1)
+RMAPI constexpr Matrix ToMatrix(Transform t)
+{
+    Matrix result = { t.m0, t.m4, t.m8, t.m12,
+                      t.m1, t.m5, t.m9, t.m13,
+                      t.m2, t.m6, t.m10, t.m14,
+                      0.0f, 0.0f, 0.0f, 1.0f };
+
+    return result;
+}
+
+// Compose two transforms (same order as Multiply(Matrix, Matrix): left is applied first)
+// 36 multiplies instead of 64 since the projective rows are known.
+RMAPI constexpr Transform Multiply(Transform left, Transform right)
+{
+    Transform result = { 0 };
+
+    result.m0 = left.m0 * right.m0 + left.m1 * right.m4 + left.m2 * right.m8;
+    result.m1 = left.m0 * right.m1 + left.m1 * right.m5 + left.m2 * right.m9;
+    result.m2 = left.m0 * right.m2 + left.m1 * right.m6 + left.m2 * right.m10;
+    result.m4 = left.m4 * right.m0 + left.m5 * right.m4 + left.m6 * right.m8;
+    result.m5 = left.m4 * right.m1 + left.m5 * right.m5 + left.m6 * right.m9;
+    result.m6 = left.m4 * right.m2 + left.m5 * right.m6 + left.m6 * right.m10;
+    result.m8 = left.m8 * right.m0 + left.m9 * right.m4 + left.m10 * right.m8;
+    result.m9 = left.m8 * right.m1 + left.m9 * right.m5 + left.m10 * right.m9;
+    result.m10 = left.m8 * right.m2 + left.m9 * right.m6 + left.m10 * right.m10;
+    result.m12 = left.m12 * right.m0 + left.m13 * right.m4 + left.m14 * right.m8 + right.m12;
+    result.m13 = left.m12 * right.m1 + left.m13 * right.m5 + left.m14 * right.m9 + right.m13;
+    result.m14 = left.m12 * right.m2 + left.m13 * right.m6 + left.m14 * right.m10 + right.m14;
+
+    return result;
+}
+
+// Compose a transform with a full matrix (ie world * viewProjection), skipping the transform's projective row
+RMAPI constexpr Matrix Multiply(Transform left, Matrix right)
+{
+    Matrix result = { 0 };
+
+    result.m0 = left.m0 * right.m0 + left.m1 * right.m4 + left.m2 * right.m8;
+    result.m1 = left.m0 * right.m1 + left.m1 * right.m5 + left.m2 * right.m9;
+    result.m2 = left.m0 * right.m2 + left.m1 * right.m6 + left.m2 * right.m10;
+    result.m3 = left.m0 * right.m3 + left.m1 * right.m7 + left.m2 * right.m11;
+    result.m4 = left.m4 * right.m0 + left.m5 * right.m4 + left.m6 * right.m8;
+    result.m5 = left.m4 * right.m1 + left.m5 * right.m5 + left.m6 * right.m9;
+    result.m6 = left.m4 * right.m2 + left.m5 * right.m6 + left.m6 * right.m10;
+    result.m7 = left.m4 * right.m3 + left.m5 * right.m7 + left.m6 * right.m11;
+    result.m8 = left.m8 * right.m0 + left.m9 * right.m4 + left.m10 * right.m8;
+    result.m9 = left.m8 * right.m1 + left.m9 * right.m5 + left.m10 * right.m9;
+    result.m10 = left.m8 * right.m2 + left.m9 * right.m6 + left.m10 * right.m10;
+    result.m11 = left.m8 * right.m3 + left.m9 * right.m7 + left.m10 * right.m11;
+    result.m12 = left.m12 * right.m0 + left.m13 * right.m4 + left.m14 * right.m8 + right.m12;
+    result.m13 = left.m12 * right.m1 + left.m13 * right.m5 + left.m14 * right.m9 + right.m13;
+    result.m14 = left.m12 * right.m2 + left.m13 * right.m6 + left.m14 * right.m10 + right.m14;
+    result.m15 = left.m12 * right.m3 + left.m13 * right.m7 + left.m14 * right.m11 + right.m15;
+
+    return result;
+}
+
+// Transforms a point by a given Transform
+RMAPI constexpr Vector3 Multiply(Vector3 v, Transform t)
+{
+    Vector3 result = { 0 };
+
+    result.x = t.m0 * v.x + t.m4 * v.y + t.m8 * v.z + t.m12;
+    result.y = t.m1 * v.x + t.m5 * v.y + t.m9 * v.z + t.m13;
+    result.z = t.m2 * v.x + t.m6 * v.y + t.m10 * v.z + t.m14;
+
+    return result;
+}
+
+// Closed-form inverse: the 3x3 block is inverted with cross products (rows of the inverse are
+// (b x c, c x a, a x b) / det for columns a, b, c), then the translation is rotated back.
+RMAPI constexpr Transform Invert(Transform t)
+{
+    Transform result = { 0 };
+
+    Vector3 a = { t.m0, t.m1, t.m2 };
+    Vector3 b = { t.m4, t.m5, t.m6 };
+    Vector3 c = { t.m8, t.m9, t.m10 };
+
+    Vector3 r0 = Cross(b, c);
+    Vector3 r1 = Cross(c, a);
+    Vector3 r2 = Cross(a, b);
+    float invDet = 1.0f / Dot(a, r0);
+    r0 = r0 * invDet;
+    r1 = r1 * invDet;
+    r2 = r2 * invDet;
+
+    result.m0 = r0.x; result.m4 = r0.y; result.m8 = r0.z;
+    result.m1 = r1.x; result.m5 = r1.y; result.m9 = r1.z;
+    result.m2 = r2.x; result.m6 = r2.y; result.m10 = r2.z;
+
+    Vector3 translation = { t.m12, t.m13, t.m14 };
+    result.m12 = -Dot(r0, translation);
+    result.m13 = -Dot(r1, translation);
+    result.m14 = -Dot(r2, translation);
+
+    return result;
+}
+
+// Normal matrix (inverse-transpose of the 3x3 block) without a general 4x4 inverse
+// Same result as Transpose(Invert(world)) for affine world matrices, ready for SendMat3.
+RMAPI constexpr Matrix NormalMatrix(Transform t)
 {
-    int result = (((fabsf(p.x - q.x)) <= (EPSILON * fmaxf(1.0f, fmaxf(fabsf(p.x), fabsf(q.x))))) &&
-        ((fabsf(p.y - q.y)) <= (EPSILON * fmaxf(1.0f, fmaxf(fabsf(p.y), fabsf(q.y))))) &&
-        ((fabsf(p.z - q.z)) <= (EPSILON * fmaxf(1.0f, fmaxf(fabsf(p.z), fabsf(q.z))))) &&
-        ((fabsf(p.w - q.w)) <= (EPSILON * fmaxf(1.0f, fmaxf(fabsf(p.w), fabsf(q.w)))))) ||
-        (((fabsf(p.x + q.x)) <= (EPSILON * fmaxf(1.0f, fmaxf(fabsf(p.x), fabsf(q.x))))) &&
-            ((fabsf(p.y + q.y)) <= (EPSILON * fmaxf(1.0f, fmaxf(fabsf(p.y), fabsf(q.y))))) &&
-            ((fabsf(p.z + q.z)) <= (EPSILON * fmaxf(1.0f, fmaxf(fabsf(p.z), fabsf(q.z))))) &&
-            ((fabsf(p.w + q.w)) <= (EPSILON * fmaxf(1.0f, fmaxf(fabsf(p.w), fabsf(q.w))))));
+    Vector3 a = { t.m0, t.m1, t.m2 };
+    Vector3 b = { t.m4, t.m5, t.m6 };
+    Vector3 c = { t.m8, t.m9, t.m10 };
+
+    Vector3 c0 = Cross(b, c);
+    Vector3 c1 = Cross(c, a);
+    Vector3 c2 = Cross(a, b);
+    float invDet = 1.0f / Dot(a, c0);
+    c0 = c0 * invDet;
+    c1 = c1 * invDet;
+    c2 = c2 * invDet;
+
+    Matrix result = { c0.x, c1.x, c2.x, 0.0f,
+                      c0.y, c1.y, c2.y, 0.0f,
+                      c0.z, c1.z, c2.z, 0.0f,
+                      0.0f, 0.0f, 0.0f, 1.0f };
 
     return result;
 }
 
+RMAPI constexpr Transform operator*(Transform a, Transform b)
+{
+    return Multiply(a, b);
+}
+
+RMAPI constexpr Matrix operator*(Transform a, Matrix b)
+{
+    return Multiply(a, b);
+}
+
+RMAPI constexpr Vector3 operator*(Transform t, Vector3 v)
+{
+    return Multiply(v, t);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Frustum culling
+//----------------------------------------------------------------------------------
+
+// Scale plane so its normal has unit length (distances become world units)
+RMAPI constexpr Plane Normalize(Plane plane)
+{
+    float length = Length(plane.normal);
+    if (length == 0.0f) length = 1.0f;
+    float ilength = 1.0f / length;
+
+    Plane result = { plane.normal * ilength, plane.d * ilength };
+
+    return result;
+}
+
+// Signed distance from plane to point (positive in front)
+RMAPI constexpr float Distance(Plane plane, Vector3 point)
+{
+    return plane.normal.x * point.x + plane.normal.y * point.y + plane.normal.z * point.z + plane.d;
+}
+
+// Extract the frustum planes of a view-projection matrix (Gribb & Hartmann).
+// Planes are in the space the matrix transforms from: pass view * proj for world-space planes,
+// or world * view * proj for object-space planes.
+RMAPI constexpr ViewFrustum ExtractFrustum(Matrix viewProj)
+{
+    const Matrix& m = viewProj;
+    Vector4 row0 = { m.m0, m.m4, m.m8, m.m12 };
+    Vector4 row1 = { m.m1, m.m5, m.m9, m.m13 };
+    Vector4 row2 = { m.m2, m.m6, m.m10, m.m14 };
+    Vector4 row3 = { m.m3, m.m7, m.m11, m.m15 };
+
+    Vector4 planes[6] = { row3 + row0, row3 - row0, row3 + row1, row3 - row1, row3 + row2, row3 - row2 };
+
+    ViewFrustum result = { };
+    for (int i = 0; i < 6; i++)
+        result.planes[i] = Normalize(Plane{ { planes[i].x, planes[i].y, planes[i].z }, planes[i].w });
+
+    return result;
+}
+
+// Check whether a sphere is at least partially inside the frustum
+RMAPI constexpr bool SphereInFrustum(const ViewFrustum& frustum, Vector3 center, float radius)
+{
+    for (int i = 0; i < 6; i++)
+    {
+        if (Distance(frustum.planes[i], center) < -radius)
+            return false;
+    }
+    return true;
+}
+
+// Check whether an axis-aligned box is at least partially inside the frustum.
+// Conservative: boxes near a frustum corner can pass while being outside.
+RMAPI constexpr bool AabbInFrustum(const ViewFrustum& frustum, Vector3 min, Vector3 max)
+{
+    for (int i = 0; i < 6; i++)
+    {
+        // Test the corner furthest along the plane normal
+        const Plane& plane = frustum.planes[i];
+        Vector3 corner = {
+            plane.normal.x >= 0.0f ? max.x : min.x,
+            plane.normal.y >= 0.0f ? max.y : min.y,
+            plane.normal.z >= 0.0f ? max.z : min.z
+        };
+
+        if (Distance(plane, corner) < 0.0f)
+            return false;
+    }
+    return true;
+}
+
+// Largest length mat scales one of its axes to. Multiplying a bounding sphere's radius by this keeps it
+// conservative for any rotation * scale matrix (sheared matrices can stretch further).
+RMAPI constexpr float MaxAxisScale(Matrix mat)
+{
+    float x = mat.m0 * mat.m0 + mat.m1 * mat.m1 + mat.m2 * mat.m2;
+    float y = mat.m4 * mat.m4 + mat.m5 * mat.m5 + mat.m6 * mat.m6;
+    float z = mat.m8 * mat.m8 + mat.m9 * mat.m9 + mat.m10 * mat.m10;
+    return Sqrt(Max(x, Max(y, z)));
+}
+
+// Axis-aligned box containing the box (min, max) transformed by mat (Arvo 1990)
+RMAPI constexpr void TransformAabb(Matrix mat, Vector3 min, Vector3 max, Vector3* outMin, Vector3* outMax)
+{
+    Vector3 center = Multiply((min + max) * 0.5f, mat);
+    Vector3 half = (max - min) * 0.5f;
+    Vector3 extent = {
+        Abs(mat.m0) * half.x + Abs(mat.m4) * half.y + Abs(mat.m8) * half.z,
+        Abs(mat.m1) * half.x + Abs(mat.m5) * half.y + Abs(mat.m9) * half.z,
+        Abs(mat.m2) * half.x + Abs(mat.m6) * half.y + Abs(mat.m10) * half.z
+    };
+    *outMin = center - extent;
+    *outMax = center + extent;
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Vector & Matrix helpers
 //----------------------------------------------------------------------------------
 
-RMAPI Vector3 Forward(Matrix m)
+RMAPI constexpr Vector3 Forward(Matrix m)
 {
     return { m.m8, m.m9, m.m10 };
 }
 
-RMAPI Vector3 Right(Matrix m)
+RMAPI constexpr Vector3 Right(Matrix m)
 {
     return { m.m0, m.m1, m.m2 };
 }
 
-RMAPI Vector3 Up(Matrix m)
+RMAPI constexpr Vector3 Up(Matrix m)
 {
     return { m.m4, m.m5, m.m6 };
 }
 
-RMAPI Vector3 Translation(Matrix m)
+RMAPI constexpr Vector3 Translation(Matrix m)
 {
     return { m.m12, m.m13, m.m14 };
 }
 
-RMAPI Matrix Translate(Vector3 v)
+RMAPI constexpr Matrix Translate(Vector3 v)
 {
     return Translate(v.x, v.y, v.z);
 }
 
-RMAPI Quaternion FromEuler(Vector3 v)
+RMAPI constexpr Quaternion FromEuler(Vector3 v)
 {
     return FromEuler(v.x, v.y, v.z);
 }
 
-RMAPI Matrix Scale(Vector3 v)
+RMAPI constexpr Matrix Scale(Vector3 v)
 {
     return Scale(v.x, v.y, v.z);
 }
@@ -2298,132 +3103,132 @@ RMAPI Matrix Scale(Vector3 v)
 // Module Functions Definition - Global operator overloads
 //----------------------------------------------------------------------------------
 
-RMAPI Vector2 operator+(Vector2 a, Vector2 b)
+RMAPI constexpr Vector2 operator+(Vector2 a, Vector2 b)
 {
     return Add(a, b);
 }
 
-RMAPI Vector2 operator-(Vector2 a, Vector2 b)
+RMAPI constexpr Vector2 operator-(Vector2 a, Vector2 b)
 {
     return Subtract(a, b);
 }
 
-RMAPI Vector2 operator*(Vector2 a, Vector2 b)
+RMAPI constexpr Vector2 operator*(Vector2 a, Vector2 b)
 {
     return Multiply(a, b);
 }
 
-RMAPI Vector2 operator/(Vector2 a, Vector2 b)
+RMAPI constexpr Vector2 operator/(Vector2 a, Vector2 b)
 {
     return Divide(a, b);
 }
 
-RMAPI Vector2 operator+(Vector2 a, float b)
+RMAPI constexpr Vector2 operator+(Vector2 a, float b)
 {
     return Add(a, b);
 }
 
-RMAPI Vector2 operator-(Vector2 a, float b)
+RMAPI constexpr Vector2 operator-(Vector2 a, float b)
 {
     return Subtract(a, b);
 }
 
-RMAPI Vector2 operator*(Vector2 a, float b)
+RMAPI constexpr Vector2 operator*(Vector2 a, float b)
 {
     return Scale(a, b);
 }
 
-RMAPI Vector2 operator/(Vector2 a, float b)
+RMAPI constexpr Vector2 operator/(Vector2 a, float b)
 {
     return Scale(a, 1.0f / b);
 }
 
-RMAPI Vector3 operator+(Vector3 a, Vector3 b)
+RMAPI constexpr Vector3 operator+(Vector3 a, Vector3 b)
 {
     return Add(a, b);
 }
 
-RMAPI Vector3 operator-(Vector3 a, Vector3 b)
+RMAPI constexpr Vector3 operator-(Vector3 a, Vector3 b)
 {
     return Subtract(a, b);
 }
 
-RMAPI Vector3 operator*(Vector3 a, Vector3 b)
+RMAPI constexpr Vector3 operator*(Vector3 a, Vector3 b)
 {
     return Multiply(a, b);
 }
 
-RMAPI Vector3 operator/(Vector3 a, Vector3 b)
+RMAPI constexpr Vector3 operator/(Vector3 a, Vector3 b)
 {
     return Divide(a, b);
 }
 
-RMAPI Vector3 operator+(Vector3 a, float b)
+RMAPI constexpr Vector3 operator+(Vector3 a, float b)
 {
     return Add(a, b);
 }
 
-RMAPI Vector3 operator-(Vector3 a, float b)
+RMAPI constexpr Vector3 operator-(Vector3 a, float b)
 {
     return Subtract(a, b);
 }
 
-RMAPI Vector3 operator*(Vector3 a, float b)
+RMAPI constexpr Vector3 operator*(Vector3 a, float b)
 {
     return Scale(a, b);
 }
 
-RMAPI Vector3 operator/(Vector3 a, float b)
+RMAPI constexpr Vector3 operator/(Vector3 a, float b)
 {
     return Scale(a, 1.0f / b);
 }
 
-RMAPI Vector4 operator+(Vector4 a,  Vector4 b)
+RMAPI constexpr Vector4 operator+(Vector4 a,  Vector4 b)
 {
     return Add(a, b);
 }
 
-RMAPI Vector4 operator-(Vector4 a,  Vector4 b)
+RMAPI constexpr Vector4 operator-(Vector4 a,  Vector4 b)
 {
     return Subtract(a, b);
 }
 
-RMAPI Vector4 operator*(Vector4 a,  Vector4 b)
+RMAPI constexpr Vector4 operator*(Vector4 a,  Vector4 b)
 {
     return Multiply(a, b);
 }
 
-RMAPI Vector4 operator/(Vector4 a,  Vector4 b)
+RMAPI constexpr Vector4 operator/(Vector4 a,  Vector4 b)
 {
     return Divide(a, b);
 }
 
-RMAPI Vector4 operator+(Vector4 a, float b)
+RMAPI constexpr Vector4 operator+(Vector4 a, float b)
 {
     return Add(a, b);
 }
 
-RMAPI Vector4 operator-(Vector4 a, float b)
+RMAPI constexpr Vector4 operator-(Vector4 a, float b)
 {
     return Subtract(a, b);
 }
 
-RMAPI Vector4 operator*(Vector4 a, float b)
+RMAPI constexpr Vector4 operator*(Vector4 a, float b)
 {
     return Scale(a, b);
 }
 
-RMAPI Vector4 operator/(Vector4 a, float b)
+RMAPI constexpr Vector4 operator/(Vector4 a, float b)
 {
     return Scale(a, 1.0f / b);
 }
 
-RMAPI Matrix operator+(Matrix a, Matrix b)
+RMAPI constexpr Matrix operator+(Matrix a, Matrix b)
 {
     return Add(a, b);
 }
 
-RMAPI Matrix operator-(Matrix a, Matrix b)
+RMAPI constexpr Matrix operator-(Matrix a, Matrix b)
 {
     return Subtract(a, b);
 }
@@ -2432,27 +3237,27 @@ RMAPI Matrix operator-(Matrix a, Matrix b)
 // Module Functions Definition - Matrix multiplication overloads
 //----------------------------------------------------------------------------------
 
-RMAPI Matrix operator*(Matrix a, Matrix b)
+RMAPI constexpr Matrix operator*(Matrix a, Matrix b)
 {
     return Multiply(a, b);
 }
 
-RMAPI Vector4 operator*(Matrix m, Vector4 v)
+RMAPI constexpr Vector4 operator*(Matrix m, Vector4 v)
 {
     return Multiply(v, m);
 }
 
-RMAPI Vector3 operator*(Matrix m, Vector3 v)
+RMAPI constexpr Vector3 operator*(Matrix m, Vector3 v)
 {
     return Multiply(v, m);
 }
 
-RMAPI Vector2 operator*(Matrix m, Vector2 v)
+RMAPI constexpr Vector2 operator*(Matrix m, Vector2 v)
 {
     return Multiply(v, m);
 }
 
-RMAPI Vector3 operator*(Quaternion a, Vector3 b)
+RMAPI constexpr Vector3 operator*(Quaternion a, Vector3 b)
 {
     // Not part of raylib but uses ToMatrix which is part of raylib
     return Multiply(b, ToMatrix(a));
@@ -2462,63 +3267,63 @@ RMAPI Vector3 operator*(Quaternion a, Vector3 b)
 // Module Functions Definition - Member operator overloads
 //----------------------------------------------------------------------------------
 
-RMAPI Vector2 Vector2::operator+=(Vector2 v)
+RMAPI constexpr Vector2 Vector2::operator+=(Vector2 v)
 {
     x += v.x;
     y += v.y;
     return *this;
 }
 
-RMAPI Vector2 Vector2::operator-=(Vector2 v)
+RMAPI constexpr Vector2 Vector2::operator-=(Vector2 v)
 {
     x -= v.x;
     y -= v.y;
     return *this;
 }
 
-RMAPI Vector2 Vector2::operator*=(Vector2 v)
+RMAPI constexpr Vector2 Vector2::operator*=(Vector2 v)
 {
     x *= v.x;
     y *= v.y;
     return *this;
 }
 
-RMAPI Vector2 Vector2::operator/=(Vector2 v)
+RMAPI constexpr Vector2 Vector2::operator/=(Vector2 v)
 {
     x /= v.x;
     y /= v.y;
     return *this;
 }
 
-RMAPI Vector2 Vector2::operator+=(float f)
+RMAPI constexpr Vector2 Vector2::operator+=(float f)
 {
     x += f;
     y += f;
     return *this;
 }
 
-RMAPI Vector2 Vector2::operator-=(float f)
+RMAPI constexpr Vector2 Vector2::operator-=(float f)
 {
     x -= f;
     y -= f;
     return *this;
 }
 
-RMAPI Vector2 Vector2::operator*=(float f)
+RMAPI constexpr Vector2 Vector2::operator*=(float f)
 {
     x *= f;
     y *= f;
     return *this;
 }
 
-RMAPI Vector2 Vector2::operator/=(float f)
+RMAPI constexpr Vector2 Vector2::operator/=(float f)
 {
     x /= f;
     y /= f;
     return *this;
 }
 
-RMAPI Vector3 Vector3::operator+=(Vector3 v)
+RMAPI constexpr Vector3 Vector3::operator+=(Vector3 v)
 {
     x += v.x;
     y += v.y;
@@ -2526,7 +3331,7 @@ RMAPI Vector3 Vector3::operator+=(Vector3 v)
     return *this;
 }
 
-RMAPI Vector3 Vector3::operator-=(Vector3 v)
+RMAPI constexpr Vector3 Vector3::operator-=(Vector3 v)
 {
     x -= v.x;
     y -= v.y;
@@ -2534,7 +3339,7 @@ RMAPI Vector3 Vector3::operator-=(Vector3 v)
     return *this;
 }
 
-RMAPI Vector3 Vector3::operator*=(Vector3 v)
+RMAPI constexpr Vector3 Vector3::operator*=(Vector3 v)
 {
     x *= v.x;
     y *= v.y;
@@ -2542,7 +3347,7 @@ RMAPI Vector3 Vector3::operator*=(Vector3 v)
     return *this;
 }
 
-RMAPI Vector3 Vector3::operator/=(Vector3 v)
+RMAPI constexpr Vector3 Vector3::operator/=(Vector3 v)
 {
     x /= v.x;
     y /= v.y;
@@ -2550,7 +3355,7 @@ RMAPI Vector3 Vector3::operator/=(Vector3 v)
     return *this;
 }
 
-RMAPI Vector3 Vector3::operator+=(float f)
+RMAPI constexpr Vector3 Vector3::operator+=(float f)
 {
     x += f;
     y += f;
@@ -2558,7 +3363,7 @@ RMAPI Vector3 Vector3::operator+=(float f)
     return *this;
 }
 
-RMAPI Vector3 Vector3::operator-=(float f)
+RMAPI constexpr Vector3 Vector3::operator-=(float f)
 {
     x -= f;
     y -= f;
@@ -2566,7 +3371,7 @@ RMAPI Vector3 Vector3::operator-=(float f)
     return *this;
 }
 
-RMAPI Vector3 Vector3::operator*=(float f)
+RMAPI constexpr Vector3 Vector3::operator*=(float f)
 {
     x *= f;
     y *= f;
@@ -2574,7 +3379,7 @@ RMAPI Vector3 Vector3::operator*=(float f)
     return *this;
 }
 
-RMAPI Vector3 Vector3::operator/=(float f)
+RMAPI constexpr Vector3 Vector3::operator/=(float f)
 {
     x /= f;
     y /= f;
@@ -2582,7 +3387,7 @@ RMAPI Vector3 Vector3::operator/=(float f)
     return *this;
 }
 
-RMAPI Vector4 Vector4::operator+=(Vector4 v)
+RMAPI constexpr Vector4 Vector4::operator+=(Vector4 v)
 {
     x += v.x;
     y += v.y;
@@ -2591,7 +3396,7 @@ RMAPI Vector4 Vector4::operator+=(Vector4 v)
     return *this;
 }
 
-RMAPI Vector4 Vector4::operator-=(Vector4 v)
+RMAPI constexpr Vector4 Vector4::operator-=(Vector4 v)
 {
     x -= v.x;
     y -= v.y;
@@ -2600,7 +3405,7 @@ RMAPI Vector4 Vector4::operator-=(Vector4 v)
     return *this;
 }
 
-RMAPI Vector4 Vector4::operator*=(Vector4 v)
+RMAPI constexpr Vector4 Vector4::operator*=(Vector4 v)
 {
     x *= v.x;
     y *= v.y;
@@ -2609,7 +3414,7 @@ RMAPI Vector4 Vector4::operator*=(Vector4 v)
     return *this;
 }
 
-RMAPI Vector4 Vector4::operator/=(Vector4 v)
+RMAPI constexpr Vector4 Vector4::operator/=(Vector4 v)
 {
     x /= v.x;
     y /= v.y;
@@ -2618,7 +3423,7 @@ RMAPI Vector4 Vector4::operator/=(Vector4 v)
     return *this;
 }
 
-RMAPI Vector4 Vector4::operator+=(float f)
+RMAPI constexpr Vector4 Vector4::operator+=(float f)
 {
     x += f;
     y += f;
@@ -2627,7 +3432,7 @@ RMAPI Vector4 Vector4::operator+=(float f)
     return *this;
 }
 
-RMAPI Vector4 Vector4::operator-=(float f)
+RMAPI constexpr Vector4 Vector4::operator-=(float f)
 {
     x -= f;
     y -= f;
@@ -2636,7 +3441,7 @@ RMAPI Vector4 Vector4::operator-=(float f)
     return *this;
 }
 
-RMAPI Vector4 Vector4::operator*=(float f)
+RMAPI constexpr Vector4 Vector4::operator*=(float f)
 {
     x *= f;
     y *= f;
@@ -2645,7 +3450,7 @@ RMAPI Vector4 Vector4::operator*=(float f)
     return *this;
 }
 
-RMAPI Vector4 Vector4::operator/=(float f)
+RMAPI constexpr Vector4 Vector4::operator/=(float f)
 {
     x /= f;
     y /= f;
@@ -2654,22 +3459,42 @@ RMAPI Vector4 Vector4::operator/=(float f)
     return *this;
 }
 
-RMAPI Vector2::operator Vector3() const
+RMAPI constexpr Vector2::operator Vector3() const
 {
     return { x, y, 0.0f };
 }
 
-RMAPI Vector3::operator Vector2() const
+RMAPI constexpr Vector3::operator Vector2() const
 {
     return { x, y };
 }
 
-RMAPI Vector3::operator Vector4() const
+RMAPI constexpr Vector3::operator Vector4() const
 {
     return { x, y, z, 1.0f };
 }
 
-RMAPI Vector4::operator Vector3() const
+RMAPI constexpr Vector4::operator Vector3() const
 {
     return { x, y, z };
 }
+
+//----------------------------------------------------------------------------------
+// Compile-time checks (constant evaluation of the core math)
+//----------------------------------------------------------------------------------
+static_assert(Multiply(Translate(1.0f, 2.0f, 3.0f), Scale(2.0f, 2.0f, 2.0f)).m12 == 2.0f, "Multiply applies left first");
+static_assert(Transpose(Translate(1.0f, 2.0f, 3.0f)).m3 == 1.0f, "Transpose swaps rows and columns");
+static_assert(Invert(Scale(2.0f, 4.0f, 8.0f)).m5 == 0.25f, "Invert of a scale");
+static_assert(Invert(Translate(1.0f, 2.0f, 3.0f)).m14 == -3.0f, "Invert of a translation");
+static_assert(Equals(Multiply(Invert(Transform{ 2.0f, 0.0f, 0.0f, 1.0f, 0.0f, 3.0f, 0.0f, 2.0f, 0.0f, 0.0f, 4.0f, 3.0f }), Transform{ 2.0f, 0.0f, 0.0f, 1.0f, 0.0f, 3.0f, 0.0f, 2.0f, 0.0f, 0.0f, 4.0f, 3.0f }).m12, 0.0f), "Transform inverse");
+static_assert(Equals(Sqrt(2.0f) * Sqrt(2.0f), 2.0f), "constexpr Sqrt");
+static_assert(Equals(Sin(PI / 6.0f), 0.5f) && Equals(Cos(PI / 3.0f), 0.5f), "constexpr Sin & Cos");
+static_assert(Equals(Atan2(1.0f, 1.0f), PI / 4.0f) && Equals(Acos(0.0f), PI / 2.0f), "constexpr inverse trig");
+static_assert(Floor(-1.5f) == -2.0f && Wrap(5.0f, 0.0f, 2.0f) == 1.0f, "constexpr Floor");
+static_assert(Equals(Normalize(Vector3{ 3.0f, 4.0f, 0.0f }), Vector3{ 0.6f, 0.8f, 0.0f }), "constexpr Normalize");
+static_assert(Equals(Multiply(V3_RIGHT, RotateZ(PI * 0.5f)), V3_UP), "constexpr RotateZ");
+static_assert(Equals(Rotate(V3_FORWARD, FromAxisAngle(V3_UP, PI * 0.5f)), V3_RIGHT), "constexpr quaternion rotation");
+static_assert(Equals(Multiply(V3_ZERO, LookAt({ 0.0f, 0.0f, 5.0f }, V3_ZERO, V3_UP)), Vector3{ 0.0f, 0.0f, -5.0f }), "constexpr LookAt");
+static_assert(Perspective(PI * 0.5, 1.0, 0.1, 100.0).m11 == -1.0f && Equals(Perspective(PI * 0.5, 1.0, 0.1, 100.0).m0, 1.0f), "constexpr Perspective");
+static_assert(SphereInFrustum(ExtractFrustum(Perspective(PI * 0.5, 1.0, 0.1, 100.0)), { 0.0f, 0.0f, -10.0f }, 1.0f) &&
+    !SphereInFrustum(ExtractFrustum(Perspective(PI * 0.5, 1.0, 0.1, 100.0)), { 0.0f, 0.0f, 10.0f }, 1.0f), "constexpr frustum culling");
@@ -0,0 +1,1576 @@
+#pragma once
+#include "Math.h"
+#include "Parallel.h"
+#include <cstring>
+#include <vector>
+
+// Bulk math over arrays. Everything here has a scalar tail/fallback so results match the per-element Math.h functions.
+
+// Minimum number of elements per thread when a bulk function is asked to run in parallel
+#ifndef MATH_PARALLEL_GRAIN
+#define MATH_PARALLEL_GRAIN 16384
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - AoS <-> SoA helpers
+//----------------------------------------------------------------------------------
+
+#if defined(MATH_SSE)
+// Load 4 consecutive Vector3s (12 floats) into x, y and z registers
+RMAPI void Load3x4(const Vector3* v, __m128& x, __m128& y, __m128& z)
+{
+    const float* f = &v->x;
+    __m128 a = _mm_loadu_ps(f + 0);     // x0 y0 z0 x1
+    __m128 b = _mm_loadu_ps(f + 4);     // y1 z1 x2 y2
+    __m128 c = _mm_loadu_ps(f + 8);     // z2 x3 y3 z3
+
+    __m128 x23 = _mm_shuffle_ps(b, c, MATH_SHUFFLE(2, 2, 1, 1));
+    __m128 y01 = _mm_shuffle_ps(a, b, MATH_SHUFFLE(1, 1, 0, 0));
+    __m128 y23 = _mm_shuffle_ps(b, c, MATH_SHUFFLE(3, 3, 2, 2));
+    __m128 z01 = _mm_shuffle_ps(a, b, MATH_SHUFFLE(2, 2, 1, 1));
+    __m128 z23 = _mm_shuffle_ps(c, c, MATH_SHUFFLE(0, 3, 0, 3));
+
+    x = _mm_shuffle_ps(a, x23, MATH_SHUFFLE(0, 3, 0, 2));
+    y = _mm_shuffle_ps(y01, y23, MATH_SHUFFLE(0, 2, 0, 2));
+    z = _mm_shuffle_ps(z01, z23, MATH_SHUFFLE(0, 2, 0, 1));
+}
+
+// Store x, y and z registers as 4 consecutive Vector3s (12 floats)
+RMAPI void Store3x4(Vector3* v, __m128 x, __m128 y, __m128 z)
+{
+    float* f = &v->x;
+    __m128 a = _mm_shuffle_ps(_mm_shuffle_ps(x, y, MATH_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(z, x, MATH_SHUFFLE(0, 0, 1, 1)), MATH_SHUFFLE(0, 2, 0, 2));
+    __m128 b = _mm_shuffle_ps(_mm_shuffle_ps(y, z, MATH_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(x, y, MATH_SHUFFLE(2, 2, 2, 2)), MATH_SHUFFLE(0, 2, 0, 2));
+    __m128 c = _mm_shuffle_ps(_mm_shuffle_ps(z, x, MATH_SHUFFLE(2, 2, 3, 3)), _mm_shuffle_ps(y, z, MATH_SHUFFLE(3, 3, 3, 3)), MATH_SHUFFLE(0, 2, 0, 2));
+    _mm_storeu_ps(f + 0, a);
+    _mm_storeu_ps(f + 4, b);
+    _mm_storeu_ps(f + 8, c);
+}
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Batched transforms
+//----------------------------------------------------------------------------------
+
+// Transforms count vectors by mat with an implicit w component (1 = points, 0 = directions).
+// out may alias in.
+// There's no SSE path: the Load3x4/Store3x4 transposes cost more shuffles than the 3 dot products they feed (slower than
+// the compiler's own vectorization of the scalar loop on head.obj). The SoA overloads are the vectorized path.
+RMAPI void TransformVectors(Matrix mat, const Vector3* in, Vector3* out, int count, float w)
+{
+    int i = 0;
+#if defined(MATH_NEON)
+    float tx = mat.m12 * w, ty = mat.m13 * w, tz = mat.m14 * w;
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4x3_t v = vld3q_f32(&in[i].x);
+        float32x4x3_t r;
+        r.val[0] = vaddq_f32(vaddq_f32(vaddq_f32(vmulq_n_f32(v.val[0], mat.m0), vmulq_n_f32(v.val[1], mat.m4)), vmulq_n_f32(v.val[2], mat.m8)), vdupq_n_f32(tx));
+        r.val[1] = vaddq_f32(vaddq_f32(vaddq_f32(vmulq_n_f32(v.val[0], mat.m1), vmulq_n_f32(v.val[1], mat.m5)), vmulq_n_f32(v.val[2], mat.m9)), vdupq_n_f32(ty));
+        r.val[2] = vaddq_f32(vaddq_f32(vaddq_f32(vmulq_n_f32(v.val[0], mat.m2), vmulq_n_f32(v.val[1], mat.m6)), vmulq_n_f32(v.val[2], mat.m10)), vdupq_n_f32(tz));
+        vst3q_f32(&out[i].x, r);
+    }
+#endif
+    for (; i < count; i++)
+    {
+        Vector3 v = in[i];
+        out[i] =
+        {
+            mat.m0 * v.x + mat.m4 * v.y + mat.m8 * v.z + mat.m12 * w,
+            mat.m1 * v.x + mat.m5 * v.y + mat.m9 * v.z + mat.m13 * w,
+            mat.m2 * v.x + mat.m6 * v.y + mat.m10 * v.z + mat.m14 * w
+        };
+    }
+}
+
+// Transform points by mat (same as Multiply(Vector3, Matrix) per point)
+RMAPI void TransformPoints(Matrix mat, const Vector3* points, Vector3* out, int count, bool parallel = false)
+{
+    if (parallel)
+    {
+        ParallelFor(count, MATH_PARALLEL_GRAIN, [&](int begin, int end)
+        {
+            TransformVectors(mat, points + begin, out + begin, end - begin, 1.0f);
+        });
+    }
+    else
+        TransformVectors(mat, points, out, count, 1.0f);
+}
+
+// Transform directions by mat, ignoring translation
+RMAPI void TransformDirections(Matrix mat, const Vector3* directions, Vector3* out, int count, bool parallel = false)
+{
+    if (parallel)
+    {
+        ParallelFor(count, MATH_PARALLEL_GRAIN, [&](int begin, int end)
+        {
+            TransformVectors(mat, directions + begin, out + begin, end - begin, 0.0f);
+        });
+    }
+    else
+        TransformVectors(mat, directions, out, count, 0.0f);
+}
+
+// Serial kernel of ProjectPoints
+RMAPI void ProjectPointsRange(Matrix mat, const Vector3* points, Vector3* out, int count)
+{
+    int i = 0;
+#if defined(MATH_SSE)
+    __m128 m0 = _mm_set1_ps(mat.m0), m4 = _mm_set1_ps(mat.m4), m8 = _mm_set1_ps(mat.m8), m12 = _mm_set1_ps(mat.m12);
+    __m128 m1 = _mm_set1_ps(mat.m1), m5 = _mm_set1_ps(mat.m5), m9 = _mm_set1_ps(mat.m9), m13 = _mm_set1_ps(mat.m13);
+    __m128 m2 = _mm_set1_ps(mat.m2), m6 = _mm_set1_ps(mat.m6), m10 = _mm_set1_ps(mat.m10), m14 = _mm_set1_ps(mat.m14);
+    __m128 m3 = _mm_set1_ps(mat.m3), m7 = _mm_set1_ps(mat.m7), m11 = _mm_set1_ps(mat.m11), m15 = _mm_set1_ps(mat.m15);
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 x, y, z;
+        Load3x4(points + i, x, y, z);
+        __m128 rx = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m0, x), _mm_mul_ps(m4, y)), _mm_mul_ps(m8, z)), m12);
+        __m128 ry = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m1, x), _mm_mul_ps(m5, y)), _mm_mul_ps(m9, z)), m13);
+        __m128 rz = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m2, x), _mm_mul_ps(m6, y)), _mm_mul_ps(m10, z)), m14);
+        __m128 rw = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m3, x), _mm_mul_ps(m7, y)), _mm_mul_ps(m11, z)), m15);
+        Store3x4(out + i, _mm_div_ps(rx, rw), _mm_div_ps(ry, rw), _mm_div_ps(rz, rw));
+    }
+#elif defined(MATH_NEON)
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4x3_t v = vld3q_f32(&points[i].x);
+        float32x4_t rx = vaddq_f32(vaddq_f32(vaddq_f32(vmulq_n_f32(v.val[0], mat.m0), vmulq_n_f32(v.val[1], mat.m4)), vmulq_n_f32(v.val[2], mat.m8)), vdupq_n_f32(mat.m12));
+        float32x4_t ry = vaddq_f32(vaddq_f32(vaddq_f32(vmulq_n_f32(v.val[0], mat.m1), vmulq_n_f32(v.val[1], mat.m5)), vmulq_n_f32(v.val[2], mat.m9)), vdupq_n_f32(mat.m13));
+        float32x4_t rz = vaddq_f32(vaddq_f32(vaddq_f32(vmulq_n_f32(v.val[0], mat.m2), vmulq_n_f32(v.val[1], mat.m6)), vmulq_n_f32(v.val[2], mat.m10)), vdupq_n_f32(mat.m14));
+        float32x4_t rw = vaddq_f32(vaddq_f32(vaddq_f32(vmulq_n_f32(v.val[0], mat.m3), vmulq_n_f32(v.val[1], mat.m7)), vmulq_n_f32(v.val[2], mat.m11)), vdupq_n_f32(mat.m15));
+        float32x4x3_t r;
+        r.val[0] = vdivq_f32(rx, rw);
+        r.val[1] = vdivq_f32(ry, rw);
+        r.val[2] = vdivq_f32(rz, rw);
+        vst3q_f32(&out[i].x, r);
+    }
+#endif
+    for (; i < count; i++)
+        out[i] = Clip(mat, points[i]);
+}
+
+// Convert points from object-space to normalized-device-coordinates (same as Clip per point)
+RMAPI void ProjectPoints(Matrix mat, const Vector3* points, Vector3* out, int count, bool parallel = false)
+{
+    if (parallel)
+    {
+        ParallelFor(count, MATH_PARALLEL_GRAIN, [&](int begin, int end)
+        {
+            ProjectPointsRange(mat, points + begin, out + begin, end - begin);
+        });
+    }
+    else
+        ProjectPointsRange(mat, points, out, count);
+}
+
+// In-place overloads for whole vertex arrays such as Mesh::positions
+RMAPI void TransformPoints(Matrix mat, std::vector<Vector3>& points, bool parallel = false)
+{
+    TransformPoints(mat, points.data(), points.data(), (int)points.size(), parallel);
+}
+
+RMAPI void TransformDirections(Matrix mat, std::vector<Vector3>& directions, bool parallel = false)
+{
+    TransformDirections(mat, directions.data(), directions.data(), (int)directions.size(), parallel);
+}
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition - SIMD lanes
+//----------------------------------------------------------------------------------
+
+// 4 floats processed per instruction (SSE / NEON, scalar otherwise).
+// Comparisons return lane masks (all bits set where true) for use with Select & MoveMask.
+struct Float4 {
+    enum { Width = 4 };
+#if defined(MATH_SSE)
+    __m128 v;
+#elif defined(MATH_NEON)
+    float32x4_t v;
+#else
+    float v[4];
+#endif
+
+    RMAPI static Float4 Set(float f);
+    RMAPI static Float4 Load(const float* p);
+    RMAPI void Store(float* p) const;
+};
+
+#if defined(MATH_SSE)
+RMAPI Float4 Float4::Set(float f) { return { _mm_set1_ps(f) }; }
+RMAPI Float4 Float4::Load(const float* p) { return { _mm_loadu_ps(p) }; }
+RMAPI void Float4::Store(float* p) const { _mm_storeu_ps(p, v); }
+
+RMAPI Float4 operator+(Float4 a, Float4 b) { return { _mm_add_ps(a.v, b.v) }; }
+RMAPI Float4 operator-(Float4 a, Float4 b) { return { _mm_sub_ps(a.v, b.v) }; }
+RMAPI Float4 operator*(Float4 a, Float4 b) { return { _mm_mul_ps(a.v, b.v) }; }
+RMAPI Float4 operator/(Float4 a, Float4 b) { return { _mm_div_ps(a.v, b.v) }; }
+RMAPI Float4 operator-(Float4 a) { return { _mm_xor_ps(a.v, _mm_set1_ps(-0.0f)) }; }
+RMAPI Float4 operator&(Float4 a, Float4 b) { return { _mm_and_ps(a.v, b.v) }; }
+RMAPI Float4 operator|(Float4 a, Float4 b) { return { _mm_or_ps(a.v, b.v) }; }
+RMAPI Float4 operator<(Float4 a, Float4 b) { return { _mm_cmplt_ps(a.v, b.v) }; }
+RMAPI Float4 operator>(Float4 a, Float4 b) { return { _mm_cmpgt_ps(a.v, b.v) }; }
+RMAPI Float4 operator<=(Float4 a, Float4 b) { return { _mm_cmple_ps(a.v, b.v) }; }
+RMAPI Float4 operator>=(Float4 a, Float4 b) { return { _mm_cmpge_ps(a.v, b.v) }; }
+RMAPI Float4 operator==(Float4 a, Float4 b) { return { _mm_cmpeq_ps(a.v, b.v) }; }
+RMAPI Float4 Min(Float4 a, Float4 b) { return { _mm_min_ps(a.v, b.v) }; }
+RMAPI Float4 Max(Float4 a, Float4 b) { return { _mm_max_ps(a.v, b.v) }; }
+RMAPI Float4 Abs(Float4 a) { return { _mm_andnot_ps(_mm_set1_ps(-0.0f), a.v) }; }
+RMAPI Float4 Sqrt(Float4 a) { return { _mm_sqrt_ps(a.v) }; }
+RMAPI Float4 Select(Float4 mask, Float4 a, Float4 b) { return { _mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v)) }; }
+RMAPI int MoveMask(Float4 mask) { return _mm_movemask_ps(mask.v); }
+#elif defined(MATH_NEON)
+RMAPI Float4 Float4::Set(float f) { return { vdupq_n_f32(f) }; }
+RMAPI Float4 Float4::Load(const float* p) { return { vld1q_f32(p) }; }
+RMAPI void Float4::Store(float* p) const { vst1q_f32(p, v); }
+
+RMAPI Float4 operator+(Float4 a, Float4 b) { return { vaddq_f32(a.v, b.v) }; }
+RMAPI Float4 operator-(Float4 a, Float4 b) { return { vsubq_f32(a.v, b.v) }; }
+RMAPI Float4 operator*(Float4 a, Float4 b) { return { vmulq_f32(a.v, b.v) }; }
+RMAPI Float4 operator/(Float4 a, Float4 b) { return { vdivq_f32(a.v, b.v) }; }
+RMAPI Float4 operator-(Float4 a) { return { vnegq_f32(a.v) }; }
+RMAPI Float4 operator&(Float4 a, Float4 b) { return { vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(a.v), vreinterpretq_u32_f32(b.v))) }; }
+RMAPI Float4 operator|(Float4 a, Float4 b) { return { vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(a.v), vreinterpretq_u32_f32(b.v))) }; }
+RMAPI Float4 operator<(Float4 a, Float4 b) { return { vreinterpretq_f32_u32(vcltq_f32(a.v, b.v)) }; }
+RMAPI Float4 operator>(Float4 a, Float4 b) { return { vreinterpretq_f32_u32(vcgtq_f32(a.v, b.v)) }; }
+RMAPI Float4 operator<=(Float4 a, Float4 b) { return { vreinterpretq_f32_u32(vcleq_f32(a.v, b.v)) }; }
+RMAPI Float4 operator>=(Float4 a, Float4 b) { return { vreinterpretq_f32_u32(vcgeq_f32(a.v, b.v)) }; }
+RMAPI Float4 operator==(Float4 a, Float4 b) { return { vreinterpretq_f32_u32(vceqq_f32(a.v, b.v)) }; }
+RMAPI Float4 Min(Float4 a, Float4 b) { return { vminq_f32(a.v, b.v) }; }
+RMAPI Float4 Max(Float4 a, Float4 b) { return { vmaxq_f32(a.v, b.v) }; }
+RMAPI Float4 Abs(Float4 a) { return { vabsq_f32(a.v) }; }
+RMAPI Float4 Sqrt(Float4 a) { return { vsqrtq_f32(a.v) }; }
+RMAPI Float4 Select(Float4 mask, Float4 a, Float4 b) { return { vbslq_f32(vreinterpretq_u32_f32(mask.v), a.v, b.v) }; }
+RMAPI int MoveMask(Float4 mask)
+{
+    static const int32_t shifts[4] = { 0, 1, 2, 3 };
+    uint32x4_t bits = vshlq_u32(vshrq_n_u32(vreinterpretq_u32_f32(mask.v), 31), vld1q_s32(shifts));
+    return (int)vaddvq_u32(bits);
+}
+#else
+RMAPI float MaskBits(bool b)
+{
+    unsigned int bits = b ? 0xFFFFFFFFu : 0u;
+    float f;
+    memcpy(&f, &bits, sizeof(float));
+    return f;
+}
+
+RMAPI bool MaskTest(float f)
+{
+    unsigned int bits;
+    memcpy(&bits, &f, sizeof(float));
+    return (bits >> 31) != 0;
+}
+
+RMAPI Float4 Float4::Set(float f) { return { { f, f, f, f } }; }
+RMAPI Float4 Float4::Load(const float* p) { return { { p[0], p[1], p[2], p[3] } }; }
+RMAPI void Float4::Store(float* p) const { for (int i = 0; i < 4; i++) p[i] = v[i]; }
+
+#define MATH_FLOAT4_OP(expr) Float4 r; for (int i = 0; i < 4; i++) r.v[i] = (expr); return r
+RMAPI Float4 operator+(Float4 a, Float4 b) { MATH_FLOAT4_OP(a.v[i] + b.v[i]); }
+RMAPI Float4 operator-(Float4 a, Float4 b) { MATH_FLOAT4_OP(a.v[i] - b.v[i]); }
+RMAPI Float4 operator*(Float4 a, Float4 b) { MATH_FLOAT4_OP(a.v[i] * b.v[i]); }
+RMAPI Float4 operator/(Float4 a, Float4 b) { MATH_FLOAT4_OP(a.v[i] / b.v[i]); }
+RMAPI Float4 operator-(Float4 a) { MATH_FLOAT4_OP(-a.v[i]); }
+RMAPI Float4 operator&(Float4 a, Float4 b) { MATH_FLOAT4_OP(MaskBits(MaskTest(a.v[i]) && MaskTest(b.v[i]))); }
+RMAPI Float4 operator|(Float4 a, Float4 b) { MATH_FLOAT4_OP(MaskBits(MaskTest(a.v[i]) || MaskTest(b.v[i]))); }
+RMAPI Float4 operator<(Float4 a, Float4 b) { MATH_FLOAT4_OP(MaskBits(a.v[i] < b.v[i])); }
+RMAPI Float4 operator>(Float4 a, Float4 b) { MATH_FLOAT4_OP(MaskBits(a.v[i] > b.v[i])); }
+RMAPI Float4 operator<=(Float4 a, Float4 b) { MATH_FLOAT4_OP(MaskBits(a.v[i] <= b.v[i])); }
+RMAPI Float4 operator>=(Float4 a, Float4 b) { MATH_FLOAT4_OP(MaskBits(a.v[i] >= b.v[i])); }
+RMAPI Float4 operator==(Float4 a, Float4 b) { MATH_FLOAT4_OP(MaskBits(a.v[i] == b.v[i])); }
+RMAPI Float4 Min(Float4 a, Float4 b) { MATH_FLOAT4_OP(a.v[i] < b.v[i] ? a.v[i] : b.v[i]); }
+RMAPI Float4 Max(Float4 a, Float4 b) { MATH_FLOAT4_OP(a.v[i] > b.v[i] ? a.v[i] : b.v[i]); }
+RMAPI Float4 Abs(Float4 a) { MATH_FLOAT4_OP(fabsf(a.v[i])); }
+RMAPI Float4 Sqrt(Float4 a) { MATH_FLOAT4_OP(sqrtf(a.v[i])); }
+RMAPI Float4 Select(Float4 mask, Float4 a, Float4 b) { MATH_FLOAT4_OP(MaskTest(mask.v[i]) ? a.v[i] : b.v[i]); }
+#undef MATH_FLOAT4_OP
+
+RMAPI int MoveMask(Float4 mask)
+{
+    int result = 0;
+    for (int i = 0; i < 4; i++)
+        result |= MaskTest(mask.v[i]) ? (1 << i) : 0;
+    return result;
+}
+#endif
+
+// 8 floats processed per instruction (AVX, pairs of Float4 otherwise)
+struct Float8 {
+    enum { Width = 8 };
+#if defined(MATH_AVX)
+    __m256 v;
+#else
+    Float4 lo, hi;
+#endif
+
+    RMAPI static Float8 Set(float f);
+    RMAPI static Float8 Load(const float* p);
+    RMAPI void Store(float* p) const;
+};
+
+#if defined(MATH_AVX)
+RMAPI Float8 Float8::Set(float f) { return { _mm256_set1_ps(f) }; }
+RMAPI Float8 Float8::Load(const float* p) { return { _mm256_loadu_ps(p) }; }
+RMAPI void Float8::Store(float* p) const { _mm256_storeu_ps(p, v); }
+
+RMAPI Float8 operator+(Float8 a, Float8 b) { return { _mm256_add_ps(a.v, b.v) }; }
+RMAPI Float8 operator-(Float8 a, Float8 b) { return { _mm256_sub_ps(a.v, b.v) }; }
+RMAPI Float8 operator*(Float8 a, Float8 b) { return { _mm256_mul_ps(a.v, b.v) }; }
+RMAPI Float8 operator/(Float8 a, Float8 b) { return { _mm256_div_ps(a.v, b.v) }; }
+RMAPI Float8 operator-(Float8 a) { return { _mm256_xor_ps(a.v, _mm256_set1_ps(-0.0f)) }; }
+RMAPI Float8 operator&(Float8 a, Float8 b) { return { _mm256_and_ps(a.v, b.v) }; }
+RMAPI Float8 operator|(Float8 a, Float8 b) { return { _mm256_or_ps(a.v, b.v) }; }
+RMAPI Float8 operator<(Float8 a, Float8 b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ) }; }
+RMAPI Float8 operator>(Float8 a, Float8 b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ) }; }
+RMAPI Float8 operator<=(Float8 a, Float8 b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ) }; }
+RMAPI Float8 operator>=(Float8 a, Float8 b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ) }; }
+RMAPI Float8 operator==(Float8 a, Float8 b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_EQ_OQ) }; }
+RMAPI Float8 Min(Float8 a, Float8 b) { return { _mm256_min_ps(a.v, b.v) }; }
+RMAPI Float8 Max(Float8 a, Float8 b) { return { _mm256_max_ps(a.v, b.v) }; }
+RMAPI Float8 Abs(Float8 a) { return { _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a.v) }; }
+RMAPI Float8 Sqrt(Float8 a) { return { _mm256_sqrt_ps(a.v) }; }
+RMAPI Float8 Select(Float8 mask, Float8 a, Float8 b) { return { _mm256_blendv_ps(b.v, a.v, mask.v) }; }
+RMAPI int MoveMask(Float8 mask) { return _mm256_movemask_ps(mask.v); }
+#else
+RMAPI Float8 Float8::Set(float f) { return { Float4::Set(f), Float4::Set(f) }; }
+RMAPI Float8 Float8::Load(const float* p) { return { Float4::Load(p), Float4::Load(p + 4) }; }
+RMAPI void Float8::Store(float* p) const { lo.Store(p); hi.Store(p + 4); }
+
+RMAPI Float8 operator+(Float8 a, Float8 b) { return { a.lo + b.lo, a.hi + b.hi }; }
+RMAPI Float8 operator-(Float8 a, Float8 b) { return { a.lo - b.lo, a.hi - b.hi }; }
+RMAPI Float8 operator*(Float8 a, Float8 b) { return { a.lo * b.lo, a.hi * b.hi }; }
+RMAPI Float8 operator/(Float8 a, Float8 b) { return { a.lo / b.lo, a.hi / b.hi }; }
+RMAPI Float8 operator-(Float8 a) { return { -a.lo, -a.hi }; }
+RMAPI Float8 operator&(Float8 a, Float8 b) { return { a.lo & b.lo, a.hi & b.hi }; }
+RMAPI Float8 operator|(Float8 a, Float8 b) { return { a.lo | b.lo, a.hi | b.hi }; }
+RMAPI Float8 operator<(Float8 a, Float8 b) { return { a.lo < b.lo, a.hi < b.hi }; }
+RMAPI Float8 operator>(Float8 a, Float8 b) { return { a.lo > b.lo, a.hi > b.hi }; }
+RMAPI Float8 operator<=(Float8 a, Float8 b) { return { a.lo <= b.lo, a.hi <= b.hi }; }
+RMAPI Float8 operator>=(Float8 a, Float8 b) { return { a.lo >= b.lo, a.hi >= b.hi }; }
+RMAPI Float8 operator==(Float8 a, Float8 b) { return { a.lo == b.lo, a.hi == b.hi }; }
+RMAPI Float8 Min(Float8 a, Float8 b) { return { Min(a.lo, b.lo), Min(a.hi, b.hi) }; }
+RMAPI Float8 Max(Float8 a, Float8 b) { return { Max(a.lo, b.lo), Max(a.hi, b.hi) }; }
+RMAPI Float8 Abs(Float8 a) { return { Abs(a.lo), Abs(a.hi) }; }
+RMAPI Float8 Sqrt(Float8 a) { return { Sqrt(a.lo), Sqrt(a.hi) }; }
+RMAPI Float8 Select(Float8 mask, Float8 a, Float8 b) { return { Select(mask.lo, a.lo, b.lo), Select(mask.hi, a.hi, b.hi) }; }
+RMAPI int MoveMask(Float8 mask) { return MoveMask(mask.lo) | (MoveMask(mask.hi) << 4); }
+#endif
+
+// Lane types mixed with a scalar (broadcasts the scalar)
+RMAPI Float4 operator+(Float4 a, float b) { return a + Float4::Set(b); }
+RMAPI Float4 operator-(Float4 a, float b) { return a - Float4::Set(b); }
+RMAPI Float4 operator*(Float4 a, float b) { return a * Float4::Set(b); }
+RMAPI Float4 operator/(Float4 a, float b) { return a / Float4::Set(b); }
+RMAPI Float8 operator+(Float8 a, float b) { return a + Float8::Set(b); }
+RMAPI Float8 operator-(Float8 a, float b) { return a - Float8::Set(b); }
+RMAPI Float8 operator*(Float8 a, float b) { return a * Float8::Set(b); }
+RMAPI Float8 operator/(Float8 a, float b) { return a / Float8::Set(b); }
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition - Wide (structure-of-arrays) types
+//----------------------------------------------------------------------------------
+// Each member holds the same component of F::Width entities, so one instruction processes every lane.
+
+template<typename F>
+struct Vector3Wide {
+    F x;
+    F y;
+    F z;
+
+    // Broadcast v to every lane
+    RMAPI static Vector3Wide Set(Vector3 v) { return { F::Set(v.x), F::Set(v.y), F::Set(v.z) }; }
+
+    // Gather F::Width consecutive vectors
+    RMAPI static Vector3Wide Load(const Vector3* v)
+    {
+        float xs[F::Width], ys[F::Width], zs[F::Width];
+        for (int i = 0; i < F::Width; i++)
+        {
+            xs[i] = v[i].x;
+            ys[i] = v[i].y;
+            zs[i] = v[i].z;
+        }
+        return { F::Load(xs), F::Load(ys), F::Load(zs) };
+    }
+
+    // Scatter to F::Width consecutive vectors
+    RMAPI void Store(Vector3* v) const
+    {
+        float xs[F::Width], ys[F::Width], zs[F::Width];
+        x.Store(xs);
+        y.Store(ys);
+        z.Store(zs);
+        for (int i = 0; i < F::Width; i++)
+            v[i] = { xs[i], ys[i], zs[i] };
+    }
+
+    RMAPI Vector3 Get(int lane) const
+    {
+        Vector3 v[F::Width];
+        Store(v);
+        return v[lane];
+    }
+
+    RMAPI Vector3Wide operator+=(Vector3Wide v) { x = x + v.x; y = y + v.y; z = z + v.z; return *this; }
+    RMAPI Vector3Wide operator-=(Vector3Wide v) { x = x - v.x; y = y - v.y; z = z - v.z; return *this; }
+    RMAPI Vector3Wide operator*=(Vector3Wide v) { x = x * v.x; y = y * v.y; z = z * v.z; return *this; }
+    RMAPI Vector3Wide operator/=(Vector3Wide v) { x = x / v.x; y = y / v.y; z = z / v.z; return *this; }
+
+    RMAPI Vector3Wide operator+=(float f) { x = x + f; y = y + f; z = z + f; return *this; }
+    RMAPI Vector3Wide operator-=(float f) { x = x - f; y = y - f; z = z - f; return *this; }
+    RMAPI Vector3Wide operator*=(float f) { x = x * f; y = y * f; z = z * f; return *this; }
+    RMAPI Vector3Wide operator/=(float f) { x = x / f; y = y / f; z = z / f; return *this; }
+};
+
+#if defined(MATH_SSE)
+template<>
+RMAPI Vector3Wide<Float4> Vector3Wide<Float4>::Load(const Vector3* v)
+{
+    Vector3Wide<Float4> result;
+    Load3x4(v, result.x.v, result.y.v, result.z.v);
+    return result;
+}
+
+template<>
+RMAPI void Vector3Wide<Float4>::Store(Vector3* v) const
+{
+    Store3x4(v, x.v, y.v, z.v);
+}
+#endif
+
+// Logically a Vector4 per lane, same as the scalar typedef
+template<typename F>
+struct QuaternionWide {
+    F x;
+    F y;
+    F z;
+    F w;
+
+    RMAPI static QuaternionWide Set(Quaternion q) { return { F::Set(q.x), F::Set(q.y), F::Set(q.z), F::Set(q.w) }; }
+
+    RMAPI static QuaternionWide Load(const Quaternion* q)
+    {
+        float xs[F::Width], ys[F::Width], zs[F::Width], ws[F::Width];
+        for (int i = 0; i < F::Width; i++)
+        {
+            xs[i] = q[i].x;
+            ys[i] = q[i].y;
+            zs[i] = q[i].z;
+            ws[i] = q[i].w;
+        }
+        return { F::Load(xs), F::Load(ys), F::Load(zs), F::Load(ws) };
+    }
+
+    RMAPI void Store(Quaternion* q) const
+    {
+        float xs[F::Width], ys[F::Width], zs[F::Width], ws[F::Width];
+        x.Store(xs);
+        y.Store(ys);
+        z.Store(zs);
+        w.Store(ws);
+        for (int i = 0; i < F::Width; i++)
+            q[i] = { xs[i], ys[i], zs[i], ws[i] };
+    }
+
+    RMAPI Quaternion Get(int lane) const
+    {
+        Quaternion q[F::Width];
+        Store(q);
+        return q[lane];
+    }
+};
+
+// Same memory naming as Matrix (m0 m4 m8 m12 is the first row)
+template<typename F>
+struct MatrixWide {
+    F m0, m4, m8, m12;
+    F m1, m5, m9, m13;
+    F m2, m6, m10, m14;
+    F m3, m7, m11, m15;
+
+    RMAPI static MatrixWide Set(Matrix m)
+    {
+        MatrixWide result;
+        const float* src = &m.m0;
+        F* dst = &result.m0;
+        for (int i = 0; i < 16; i++)
+            dst[i] = F::Set(src[i]);
+        return result;
+    }
+
+    RMAPI static MatrixWide Load(const Matrix* m)
+    {
+        MatrixWide result;
+        F* dst = &result.m0;
+        for (int i = 0; i < 16; i++)
+        {
+            float lanes[F::Width];
+            for (int j = 0; j < F::Width; j++)
+                lanes[j] = (&m[j].m0)[i];
+            dst[i] = F::Load(lanes);
+        }
+        return result;
+    }
+
+    RMAPI void Store(Matrix* m) const
+    {
+        const F* src = &m0;
+        for (int i = 0; i < 16; i++)
+        {
+            float lanes[F::Width];
+            src[i].Store(lanes);
+            for (int j = 0; j < F::Width; j++)
+                (&m[j].m0)[i] = lanes[j];
+        }
+    }
+
+    RMAPI Matrix Get(int lane) const
+    {
+        Matrix m[F::Width];
+        Store(m);
+        return m[lane];
+    }
+};
+
+#if defined(MATH_SSE)
+// Each row of a Matrix is 4 contiguous floats, so 4 matrices transpose row by row into lanes
+template<>
+RMAPI MatrixWide<Float4> MatrixWide<Float4>::Load(const Matrix* m)
+{
+    MatrixWide<Float4> result;
+    Float4* dst = &result.m0;
+    for (int row = 0; row < 4; row++)
+    {
+        __m128 a = _mm_loadu_ps(&m[0].m0 + row * 4);
+        __m128 b = _mm_loadu_ps(&m[1].m0 + row * 4);
+        __m128 c = _mm_loadu_ps(&m[2].m0 + row * 4);
+        __m128 d = _mm_loadu_ps(&m[3].m0 + row * 4);
+        _MM_TRANSPOSE4_PS(a, b, c, d);
+        dst[row * 4 + 0].v = a;
+        dst[row * 4 + 1].v = b;
+        dst[row * 4 + 2].v = c;
+        dst[row * 4 + 3].v = d;
+    }
+    return result;
+}
+
+template<>
+RMAPI MatrixWide<Float8> MatrixWide<Float8>::Load(const Matrix* m)
+{
+    MatrixWide<Float4> lo = MatrixWide<Float4>::Load(m);
+    MatrixWide<Float4> hi = MatrixWide<Float4>::Load(m + 4);
+    MatrixWide<Float8> result;
+    for (int i = 0; i < 16; i++)
+    {
+#if defined(MATH_AVX)
+        (&result.m0)[i].v = _mm256_insertf128_ps(_mm256_castps128_ps256((&lo.m0)[i].v), (&hi.m0)[i].v, 1);
+#else
+        (&result.m0)[i] = { (&lo.m0)[i], (&hi.m0)[i] };
+#endif
+    }
+    return result;
+}
+#endif
+
+typedef Vector3Wide<Float4> Vector3x4;
+typedef Vector3Wide<Float8> Vector3x8;
+typedef QuaternionWide<Float4> Quaternionx4;
+typedef QuaternionWide<Float8> Quaternionx8;
+typedef MatrixWide<Float4> Matrixx4;
+typedef MatrixWide<Float8> Matrixx8;
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Wide Vector3 math
+//----------------------------------------------------------------------------------
+
+template<typename F> RMAPI Vector3Wide<F> operator+(Vector3Wide<F> a, Vector3Wide<F> b) { return { a.x + b.x, a.y + b.y, a.z + b.z }; }
+template<typename F> RMAPI Vector3Wide<F> operator-(Vector3Wide<F> a, Vector3Wide<F> b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+template<typename F> RMAPI Vector3Wide<F> operator*(Vector3Wide<F> a, Vector3Wide<F> b) { return { a.x * b.x, a.y * b.y, a.z * b.z }; }
+template<typename F> RMAPI Vector3Wide<F> operator/(Vector3Wide<F> a, Vector3Wide<F> b) { return { a.x / b.x, a.y / b.y, a.z / b.z }; }
+
+template<typename F> RMAPI Vector3Wide<F> operator+(Vector3Wide<F> a, float b) { return { a.x + b, a.y + b, a.z + b }; }
+template<typename F> RMAPI Vector3Wide<F> operator-(Vector3Wide<F> a, float b) { return { a.x - b, a.y - b, a.z - b }; }
+template<typename F> RMAPI Vector3Wide<F> operator*(Vector3Wide<F> a, float b) { return { a.x * b, a.y * b, a.z * b }; }
+template<typename F> RMAPI Vector3Wide<F> operator/(Vector3Wide<F> a, float b) { return { a.x / b, a.y / b, a.z / b }; }
+
+// Per-lane scale
+template<typename F> RMAPI Vector3Wide<F> operator*(Vector3Wide<F> a, F b) { return { a.x * b, a.y * b, a.z * b }; }
+template<typename F> RMAPI Vector3Wide<F> operator/(Vector3Wide<F> a, F b) { return { a.x / b, a.y / b, a.z / b }; }
+
+template<typename F> RMAPI Vector3Wide<F> Negate(Vector3Wide<F> v) { return { -v.x, -v.y, -v.z }; }
+
+template<typename F> RMAPI F Dot(Vector3Wide<F> v1, Vector3Wide<F> v2)
+{
+    return v1.x * v2.x + v1.y * v2.y + v1.z * v2.z;
+}
+
+template<typename F> RMAPI Vector3Wide<F> Cross(Vector3Wide<F> v1, Vector3Wide<F> v2)
+{
+    return { v1.y * v2.z - v1.z * v2.y, v1.z * v2.x - v1.x * v2.z, v1.x * v2.y - v1.y * v2.x };
+}
+
+template<typename F> RMAPI F LengthSqr(Vector3Wide<F> v)
+{
+    return v.x * v.x + v.y * v.y + v.z * v.z;
+}
+
+template<typename F> RMAPI F Length(Vector3Wide<F> v)
+{
+    return Sqrt(LengthSqr(v));
+}
+
+template<typename F> RMAPI F DistanceSqr(Vector3Wide<F> v1, Vector3Wide<F> v2)
+{
+    return LengthSqr(v2 - v1);
+}
+
+template<typename F> RMAPI F Distance(Vector3Wide<F> v1, Vector3Wide<F> v2)
+{
+    return Length(v2 - v1);
+}
+
+// Zero-length lanes are returned unchanged (same as the scalar Normalize)
+template<typename F> RMAPI Vector3Wide<F> Normalize(Vector3Wide<F> v)
+{
+    F length = Length(v);
+    length = Select(length == F::Set(0.0f), F::Set(1.0f), length);
+    F ilength = F::Set(1.0f) / length;
+    return v * ilength;
+}
+
+template<typename F> RMAPI Vector3Wide<F> Lerp(Vector3Wide<F> v1, Vector3Wide<F> v2, float amount)
+{
+    return { v1.x + (v2.x - v1.x) * amount, v1.y + (v2.y - v1.y) * amount, v1.z + (v2.z - v1.z) * amount };
+}
+
+template<typename F> RMAPI Vector3Wide<F> Min(Vector3Wide<F> v1, Vector3Wide<F> v2)
+{
+    return { Min(v1.x, v2.x), Min(v1.y, v2.y), Min(v1.z, v2.z) };
+}
+
+template<typename F> RMAPI Vector3Wide<F> Max(Vector3Wide<F> v1, Vector3Wide<F> v2)
+{
+    return { Max(v1.x, v2.x), Max(v1.y, v2.y), Max(v1.z, v2.z) };
+}
+
+template<typename F> RMAPI Vector3Wide<F> Reflect(Vector3Wide<F> v, Vector3Wide<F> normal)
+{
+    F dot2 = Dot(v, normal) * 2.0f;
+    return v - normal * dot2;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Wide Quaternion math
+//----------------------------------------------------------------------------------
+
+template<typename F> RMAPI QuaternionWide<F> operator+(QuaternionWide<F> a, QuaternionWide<F> b) { return { a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w }; }
+template<typename F> RMAPI QuaternionWide<F> operator-(QuaternionWide<F> a, QuaternionWide<F> b) { return { a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w }; }
+template<typename F> RMAPI QuaternionWide<F> operator*(QuaternionWide<F> a, float b) { return { a.x * b, a.y * b, a.z * b, a.w * b }; }
+template<typename F> RMAPI QuaternionWide<F> operator/(QuaternionWide<F> a, float b) { return { a.x / b, a.y / b, a.z / b, a.w / b }; }
+
+template<typename F> RMAPI F Dot(QuaternionWide<F> q1, QuaternionWide<F> q2)
+{
+    return q1.x * q2.x + q1.y * q2.y + q1.z * q2.z + q1.w * q2.w;
+}
+
+template<typename F> RMAPI F Length(QuaternionWide<F> q)
+{
+    return Sqrt(Dot(q, q));
+}
+
+template<typename F> RMAPI QuaternionWide<F> Normalize(QuaternionWide<F> q)
+{
+    F length = Length(q);
+    length = Select(length == F::Set(0.0f), F::Set(1.0f), length);
+    F ilength = F::Set(1.0f) / length;
+    return { q.x * ilength, q.y * ilength, q.z * ilength, q.w * ilength };
+}
+
+// Conjugate (inverse of a unit quaternion)
+template<typename F> RMAPI QuaternionWide<F> Conjugate(QuaternionWide<F> q)
+{
+    return { -q.x, -q.y, -q.z, q.w };
+}
+
+template<typename F> RMAPI QuaternionWide<F> Multiply(QuaternionWide<F> q1, QuaternionWide<F> q2)
+{
+    QuaternionWide<F> result;
+    result.x = q1.x * q2.w + q1.w * q2.x + q1.y * q2.z - q1.z * q2.y;
+    result.y = q1.y * q2.w + q1.w * q2.y + q1.z * q2.x - q1.x * q2.z;
+    result.z = q1.z * q2.w + q1.w * q2.z + q1.x * q2.y - q1.y * q2.x;
+    result.w = q1.w * q2.w - q1.x * q2.x - q1.y * q2.y - q1.z * q2.z;
+    return result;
+}
+
+template<typename F> RMAPI QuaternionWide<F> operator*(QuaternionWide<F> q1, QuaternionWide<F> q2)
+{
+    return Multiply(q1, q2);
+}
+
+template<typename F> RMAPI QuaternionWide<F> Lerp(QuaternionWide<F> q1, QuaternionWide<F> q2, float amount)
+{
+    return q1 + (q2 - q1) * amount;
+}
+
+template<typename F> RMAPI QuaternionWide<F> Nlerp(QuaternionWide<F> q1, QuaternionWide<F> q2, float amount)
+{
+    return Normalize(Lerp(q1, q2, amount));
+}
+
+// Transform a vector by quaternion rotation (same expansion as the scalar Rotate)
+template<typename F> RMAPI Vector3Wide<F> Rotate(Vector3Wide<F> v, QuaternionWide<F> q)
+{
+    F xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z, ww = q.w * q.w;
+    F xy = q.x * q.y * 2.0f, xz = q.x * q.z * 2.0f, yz = q.y * q.z * 2.0f;
+    F wx = q.w * q.x * 2.0f, wy = q.w * q.y * 2.0f, wz = q.w * q.z * 2.0f;
+
+    Vector3Wide<F> result;
+    result.x = v.x * (xx + ww - yy - zz) + v.y * (xy - wz) + v.z * (xz + wy);
+    result.y = v.x * (wz + xy) + v.y * (ww - xx + yy - zz) + v.z * (yz - wx);
+    result.z = v.x * (xz - wy) + v.y * (wx + yz) + v.z * (ww - xx - yy + zz);
+    return result;
+}
+
+template<typename F> RMAPI Vector3Wide<F> operator*(QuaternionWide<F> q, Vector3Wide<F> v)
+{
+    return Rotate(v, q);
+}
+
+template<typename F> RMAPI MatrixWide<F> ToMatrix(QuaternionWide<F> q)
+{
+    F a2 = q.x * q.x, b2 = q.y * q.y, c2 = q.z * q.z;
+    F ac = q.x * q.z, ab = q.x * q.y, bc = q.y * q.z;
+    F ad = q.w * q.x, bd = q.w * q.y, cd = q.w * q.z;
+    F zero = F::Set(0.0f), one = F::Set(1.0f);
+
+    MatrixWide<F> result;
+    result.m0 = one - (b2 + c2) * 2.0f;
+    result.m1 = (ab + cd) * 2.0f;
+    result.m2 = (ac - bd) * 2.0f;
+    result.m3 = zero;
+
+    result.m4 = (ab - cd) * 2.0f;
+    result.m5 = one - (a2 + c2) * 2.0f;
+    result.m6 = (bc + ad) * 2.0f;
+    result.m7 = zero;
+
+    result.m8 = (ac + bd) * 2.0f;
+    result.m9 = (bc - ad) * 2.0f;
+    result.m10 = one - (a2 + b2) * 2.0f;
+    result.m11 = zero;
+
+    result.m12 = zero;
+    result.m13 = zero;
+    result.m14 = zero;
+    result.m15 = one;
+    return result;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Wide Matrix math
+//----------------------------------------------------------------------------------
+
+template<typename F> RMAPI MatrixWide<F> operator+(MatrixWide<F> a, MatrixWide<F> b)
+{
+    MatrixWide<F> result;
+    for (int i = 0; i < 16; i++)
+        (&result.m0)[i] = (&a.m0)[i] + (&b.m0)[i];
+    return result;
+}
+
+template<typename F> RMAPI MatrixWide<F> operator-(MatrixWide<F> a, MatrixWide<F> b)
+{
+    MatrixWide<F> result;
+    for (int i = 0; i < 16; i++)
+        (&result.m0)[i] = (&a.m0)[i] - (&b.m0)[i];
+    return result;
+}
+
+template<typename F> RMAPI MatrixWide<F> Transpose(MatrixWide<F> mat)
+{
+    MatrixWide<F> result;
+    result.m0 = mat.m0;   result.m1 = mat.m4;   result.m2 = mat.m8;   result.m3 = mat.m12;
+    result.m4 = mat.m1;   result.m5 = mat.m5;   result.m6 = mat.m9;   result.m7 = mat.m13;
+    result.m8 = mat.m2;   result.m9 = mat.m6;   result.m10 = mat.m10; result.m11 = mat.m14;
+    result.m12 = mat.m3;  result.m13 = mat.m7;  result.m14 = mat.m11; result.m15 = mat.m15;
+    return result;
+}
+
+// Same order of operations as MultiplyScalar, so each lane matches the scalar result
+template<typename F> RMAPI MatrixWide<F> Multiply(MatrixWide<F> left, MatrixWide<F> right)
+{
+    MatrixWide<F> result;
+    result.m0 = left.m0 * right.m0 + left.m1 * right.m4 + left.m2 * right.m8 + left.m3 * right.m12;
+    result.m1 = left.m0 * right.m1 + left.m1 * right.m5 + left.m2 * right.m9 + left.m3 * right.m13;
+    result.m2 = left.m0 * right.m2 + left.m1 * right.m6 + left.m2 * right.m10 + left.m3 * right.m14;
+    result.m3 = left.m0 * right.m3 + left.m1 * right.m7 + left.m2 * right.m11 + left.m3 * right.m15;
+    result.m4 = left.m4 * right.m0 + left.m5 * right.m4 + left.m6 * right.m8 + left.m7 * right.m12;
+    result.m5 = left.m4 * right.m1 + left.m5 * right.m5 + left.m6 * right.m9 + left.m7 * right.m13;
+    result.m6 = left.m4 * right.m2 + left.m5 * right.m6 + left.m6 * right.m10 + left.m7 * right.m14;
+    result.m7 = left.m4 * right.m3 + left.m5 * right.m7 + left.m6 * right.m11 + left.m7 * right.m15;
+    result.m8 = left.m8 * right.m0 + left.m9 * right.m4 + left.m10 * right.m8 + left.m11 * right.m12;
+    result.m9 = left.m8 * right.m1 + left.m9 * right.m5 + left.m10 * right.m9 + left.m11 * right.m13;
+    result.m10 = left.m8 * right.m2 + left.m9 * right.m6 + left.m10 * right.m10 + left.m11 * right.m14;
+    result.m11 = left.m8 * right.m3 + left.m9 * right.m7 + left.m10 * right.m11 + left.m11 * right.m15;
+    result.m12 = left.m12 * right.m0 + left.m13 * right.m4 + left.m14 * right.m8 + left.m15 * right.m12;
+    result.m13 = left.m12 * right.m1 + left.m13 * right.m5 + left.m14 * right.m9 + left.m15 * right.m13;
+    result.m14 = left.m12 * right.m2 + left.m13 * right.m6 + left.m14 * right.m10 + left.m15 * right.m14;
+    result.m15 = left.m12 * right.m3 + left.m13 * right.m7 + left.m14 * right.m11 + left.m15 * right.m15;
+    return result;
+}
+
+template<typename F> RMAPI MatrixWide<F> operator*(MatrixWide<F> a, MatrixWide<F> b)
+{
+    return Multiply(a, b);
+}
+
+// Same cofactor expansion as InvertScalar
+template<typename F> RMAPI MatrixWide<F> Invert(MatrixWide<F> mat)
+{
+    F a00 = mat.m0, a01 = mat.m1, a02 = mat.m2, a03 = mat.m3;
+    F a10 = mat.m4, a11 = mat.m5, a12 = mat.m6, a13 = mat.m7;
+    F a20 = mat.m8, a21 = mat.m9, a22 = mat.m10, a23 = mat.m11;
+    F a30 = mat.m12, a31 = mat.m13, a32 = mat.m14, a33 = mat.m15;
+
+    F b00 = a00 * a11 - a01 * a10;
+    F b01 = a00 * a12 - a02 * a10;
+    F b02 = a00 * a13 - a03 * a10;
+    F b03 = a01 * a12 - a02 * a11;
+    F b04 = a01 * a13 - a03 * a11;
+    F b05 = a02 * a13 - a03 * a12;
+    F b06 = a20 * a31 - a21 * a30;
+    F b07 = a20 * a32 - a22 * a30;
+    F b08 = a20 * a33 - a23 * a30;
+    F b09 = a21 * a32 - a22 * a31;
+    F b10 = a21 * a33 - a23 * a31;
+    F b11 = a22 * a33 - a23 * a32;
+
+    F invDet = F::Set(1.0f) / (b00 * b11 - b01 * b10 + b02 * b09 + b03 * b08 - b04 * b07 + b05 * b06);
+
+    MatrixWide<F> result;
+    result.m0 = (a11 * b11 - a12 * b10 + a13 * b09) * invDet;
+    result.m1 = (-a01 * b11 + a02 * b10 - a03 * b09) * invDet;
+    result.m2 = (a31 * b05 - a32 * b04 + a33 * b03) * invDet;
+    result.m3 = (-a21 * b05 + a22 * b04 - a23 * b03) * invDet;
+    result.m4 = (-a10 * b11 + a12 * b08 - a13 * b07) * invDet;
+    result.m5 = (a00 * b11 - a02 * b08 + a03 * b07) * invDet;
+    result.m6 = (-a30 * b05 + a32 * b02 - a33 * b01) * invDet;
+    result.m7 = (a20 * b05 - a22 * b02 + a23 * b01) * invDet;
+    result.m8 = (a10 * b10 - a11 * b08 + a13 * b06) * invDet;
+    result.m9 = (-a00 * b10 + a01 * b08 - a03 * b06) * invDet;
+    result.m10 = (a30 * b04 - a31 * b02 + a33 * b00) * invDet;
+    result.m11 = (-a20 * b04 + a21 * b02 - a23 * b00) * invDet;
+    result.m12 = (-a10 * b09 + a11 * b07 - a12 * b06) * invDet;
+    result.m13 = (a00 * b09 - a01 * b07 + a02 * b06) * invDet;
+    result.m14 = (-a30 * b03 + a31 * b01 - a32 * b00) * invDet;
+    result.m15 = (a20 * b03 - a21 * b01 + a22 * b00) * invDet;
+    return result;
+}
+
+// Transforms a point by a matrix per lane (same as Multiply(Vector3, Matrix))
+template<typename F> RMAPI Vector3Wide<F> Multiply(Vector3Wide<F> v, MatrixWide<F> mat)
+{
+    Vector3Wide<F> result;
+    result.x = mat.m0 * v.x + mat.m4 * v.y + mat.m8 * v.z + mat.m12;
+    result.y = mat.m1 * v.x + mat.m5 * v.y + mat.m9 * v.z + mat.m13;
+    result.z = mat.m2 * v.x + mat.m6 * v.y + mat.m10 * v.z + mat.m14;
+    return result;
+}
+
+template<typename F> RMAPI Vector3Wide<F> operator*(MatrixWide<F> m, Vector3Wide<F> v)
+{
+    return Multiply(v, m);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Wide array conversion
+//----------------------------------------------------------------------------------
+
+// Allocator for arrays of wide types (std::allocator only guarantees 16-byte alignment before C++17)
+template<typename T>
+struct AlignedAllocator {
+    typedef T value_type;
+
+    AlignedAllocator() = default;
+    template<typename U> AlignedAllocator(const AlignedAllocator<U>&) {}
+
+    T* allocate(size_t n)
+    {
+        // Over-allocate and stash the original pointer right before the aligned block
+        size_t alignment = alignof(T) < sizeof(void*) ? sizeof(void*) : alignof(T);
+        char* raw = (char*)::operator new(n * sizeof(T) + alignment + sizeof(void*));
+        size_t address = (size_t)(raw + sizeof(void*));
+        char* aligned = (char*)((address + alignment - 1) & ~(alignment - 1));
+        ((void**)aligned)[-1] = raw;
+        return (T*)aligned;
+    }
+
+    void deallocate(T* p, size_t)
+    {
+        ::operator delete(((void**)p)[-1]);
+    }
+
+    template<typename U> bool operator==(const AlignedAllocator<U>&) const { return true; }
+    template<typename U> bool operator!=(const AlignedAllocator<U>&) const { return false; }
+};
+
+template<typename T>
+using WideArray = std::vector<T, AlignedAllocator<T>>;
+
+// Convert an array of vectors into packets of F::Width. The last packet is padded with zero vectors.
+template<typename F> RMAPI void Load(const std::vector<Vector3>& in, WideArray<Vector3Wide<F>>& out)
+{
+    int count = (int)in.size();
+    int packets = (count + F::Width - 1) / F::Width;
+    out.resize(packets);
+    for (int i = 0; i < packets; i++)
+    {
+        int begin = i * F::Width;
+        if (begin + F::Width <= count)
+            out[i] = Vector3Wide<F>::Load(in.data() + begin);
+        else
+        {
+            Vector3 tail[F::Width] = {};
+            for (int j = begin; j < count; j++)
+                tail[j - begin] = in[j];
+            out[i] = Vector3Wide<F>::Load(tail);
+        }
+    }
+}
+
+// Convert packets back into vectors. out keeps its size (the padding lanes are dropped),
+// so size it to the original element count first.
+template<typename F> RMAPI void Store(const WideArray<Vector3Wide<F>>& in, std::vector<Vector3>& out)
+{
+    int count = (int)out.size();
+    for (int i = 0; i < (int)in.size(); i++)
+    {
+        int begin = i * F::Width;
+        if (begin >= count)
+            break;
+
+        if (begin + F::Width <= count)
+            in[i].Store(out.data() + begin);
+        else
+        {
+            Vector3 tail[F::Width];
+            in[i].Store(tail);
+            for (int j = begin; j < count; j++)
+                out[j] = tail[j - begin];
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Vectorized sqrt, rsqrt, sin & cos
+//----------------------------------------------------------------------------------
+// Error bounds against a double precision reference (checked by bench/MathTest.cpp):
+//   RsqrtFast        relative 3.7e-4 (SSE/AVX, Intel's documented 1.5 * 2^-12), 3.9e-3 (NEON, 2^-8)
+//   Rsqrt            relative 1.5 e^2 + 2 eps for RsqrtFast's bound e: 4.5e-7 (SSE/AVX), 2.4e-5 (NEON). One Newton-Raphson step.
+//   SqrtFast         relative e + eps: 3.7e-4 (SSE/AVX), 3.9e-3 (NEON). x * RsqrtFast(x).
+//   SinCos           absolute 2.4e-7 (2 ulps at 1.0) for |x| <= 8192, about 9.3e-8 measured (Cephes sinf/cosf polynomials)
+// The scalar backend computes 1 / sqrt(x) exactly, so all three are within 3.2e-7.
+// Sin & cos accuracy degrades past |x| = 8192 due to single-precision range reduction.
+
+#if defined(MATH_SSE)
+RMAPI Float4 RsqrtFast(Float4 x) { return { _mm_rsqrt_ps(x.v) }; }
+#elif defined(MATH_NEON)
+RMAPI Float4 RsqrtFast(Float4 x) { return { vrsqrteq_f32(x.v) }; }
+#else
+RMAPI Float4 RsqrtFast(Float4 x) { return Float4::Set(1.0f) / Sqrt(x); }
+#endif
+
+#if defined(MATH_AVX)
+RMAPI Float8 RsqrtFast(Float8 x) { return { _mm256_rsqrt_ps(x.v) }; }
+#else
+RMAPI Float8 RsqrtFast(Float8 x) { return { RsqrtFast(x.lo), RsqrtFast(x.hi) }; }
+#endif
+
+// Round to nearest integer (exact for |x| < 2^22, no SSE4.1 needed)
+template<typename F> RMAPI F RoundKernel(F x)
+{
+    const float magic = 12582912.0f; // 1.5 * 2^23
+    return (x + magic) - magic;
+}
+
+template<typename F> RMAPI F RsqrtKernel(F x)
+{
+    // One Newton-Raphson step: y = y * (1.5 - 0.5 * x * y * y)
+    F y = RsqrtFast(x);
+    return y * (F::Set(1.5f) - x * 0.5f * y * y);
+}
+
+template<typename F> RMAPI F SqrtFastKernel(F x)
+{
+    // rsqrt(0) is inf, so zero lanes are masked back to 0
+    return Select(x > F::Set(0.0f), x * RsqrtFast(x), F::Set(0.0f));
+}
+
+// Reduce x to r in [-pi/4, pi/4] with x = r + k * pi/2 and return k mod 4 as a float (0, 1, 2 or 3)
+template<typename F> RMAPI F ReduceQuadrant(F x, F* r)
+{
+    // Cody-Waite: pi/2 split into three parts so k * part is exact
+    F k = RoundKernel(x * 0.636619772f); // 2 / pi
+    *r = x - k * 1.5703125f - k * 4.837512969970703125e-4f - k * 7.54978995489188216e-8f;
+
+    // k mod 4 without integer instructions
+    F q = k * 0.25f;
+    F fq = RoundKernel(q);
+    fq = Select(fq > q, fq - 1.0f, fq);
+    return k - fq * 4.0f;
+}
+
+template<typename F> RMAPI void SinCosKernel(F x, F* s, F* c)
+{
+    F r;
+    F quadrant = ReduceQuadrant(x, &r);
+    F r2 = r * r;
+    F sinr = r + r * r2 * (F::Set(-1.6666654611e-1f) + r2 * (F::Set(8.3321608736e-3f) + r2 * -1.9515295891e-4f));
+    F cosr = F::Set(1.0f) - r2 * 0.5f + r2 * r2 * (F::Set(4.166664568298827e-2f) + r2 * (F::Set(-1.388731625493765e-3f) + r2 * 2.443315711809948e-5f));
+
+    // Quadrant 1 & 3 swap sin and cos, quadrant 2 & 3 negate sin, quadrant 1 & 2 negate cos
+    F swap = (quadrant == F::Set(1.0f)) | (quadrant == F::Set(3.0f));
+    F sinNeg = quadrant >= F::Set(2.0f);
+    F cosNeg = (quadrant == F::Set(1.0f)) | (quadrant == F::Set(2.0f));
+    F sinv = Select(swap, cosr, sinr);
+    F cosv = Select(swap, sinr, cosr);
+    *s = Select(sinNeg, -sinv, sinv);
+    *c = Select(cosNeg, -cosv, cosv);
+}
+
+RMAPI Float4 Rsqrt(Float4 x) { return RsqrtKernel(x); }
+RMAPI Float8 Rsqrt(Float8 x) { return RsqrtKernel(x); }
+RMAPI Float4 SqrtFast(Float4 x) { return SqrtFastKernel(x); }
+RMAPI Float8 SqrtFast(Float8 x) { return SqrtFastKernel(x); }
+RMAPI void SinCos(Float4 x, Float4* s, Float4* c) { SinCosKernel(x, s, c); }
+RMAPI void SinCos(Float8 x, Float8* s, Float8* c) { SinCosKernel(x, s, c); }
+
+// Sin & cos of count angles. Every element (including the tail) goes through the same kernel.
+RMAPI void SinCos(const float* angles, float* sines, float* cosines, int count)
+{
+    int i = 0;
+    for (; i + Float8::Width <= count; i += Float8::Width)
+    {
+        Float8 sv, cv;
+        SinCosKernel(Float8::Load(angles + i), &sv, &cv);
+        sv.Store(sines + i);
+        cv.Store(cosines + i);
+    }
+
+    if (i < count)
+    {
+        int n = count - i;
+        float x[Float8::Width] = {}, s[Float8::Width], c[Float8::Width];
+        memcpy(x, angles + i, n * sizeof(float));
+
+        Float8 sv, cv;
+        SinCosKernel(Float8::Load(x), &sv, &cv);
+        sv.Store(s);
+        cv.Store(c);
+        memcpy(sines + i, s, n * sizeof(float));
+        memcpy(cosines + i, c, n * sizeof(float));
+    }
+}
+
+// Normalize count vectors. Zero-length vectors are returned unchanged (same as the scalar Normalize).
+// Uses Rsqrt, so components are within Rsqrt's bound + 2 eps of exact: 6.9e-7 (2.4e-5 on NEON). out may alias in.
+RMAPI void Normalize(const Vector3* in, Vector3* out, int count, bool parallel = false)
+{
+    if (parallel)
+    {
+        ParallelFor(count, MATH_PARALLEL_GRAIN, [&](int begin, int end)
+        {
+            Normalize(in + begin, out + begin, end - begin);
+        });
+        return;
+    }
+
+    int i = 0;
+    for (; i + Float4::Width <= count; i += Float4::Width)
+    {
+        Vector3x4 v = Vector3x4::Load(in + i);
+        Float4 lengthSqr = LengthSqr(v);
+        Float4 ilength = Select(lengthSqr > Float4::Set(0.0f), Rsqrt(lengthSqr), Float4::Set(1.0f));
+        (v * ilength).Store(out + i);
+    }
+
+    for (; i < count; i++)
+        out[i] = Normalize(in[i]);
+}
+
+RMAPI void Normalize(std::vector<Vector3>& vectors, bool parallel = false)
+{
+    Normalize(vectors.data(), vectors.data(), (int)vectors.size(), parallel);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Bulk random generation
+//----------------------------------------------------------------------------------
+// Bulk fills split the output into blocks of MATH_RANDOM_BLOCK elements. Block b uses 4 generators,
+// CreateRng(seed, 4 * b + lane), and element i of the block takes the next value of generator i % 4.
+// Every element therefore depends only on (seed, index): the results are identical whether the fill
+// runs serially or on any number of threads, and on SSE, NEON or scalar builds.
+
+#ifndef MATH_RANDOM_BLOCK
+#define MATH_RANDOM_BLOCK 4096
+#endif
+
+// 4 xoshiro128** generators stepped together, one per lane
+struct Rng4 {
+#if defined(MATH_SSE)
+    __m128i s0, s1, s2, s3;
+#elif defined(MATH_NEON)
+    uint32x4_t s0, s1, s2, s3;
+#else
+    Rng lanes[4];
+#endif
+};
+
+RMAPI Rng4 CreateRng4(uint64_t seed, uint64_t stream)
+{
+    Rng lanes[4];
+    for (int i = 0; i < 4; i++)
+        lanes[i] = CreateRng(seed, stream * 4 + i);
+
+#if defined(MATH_SSE) || defined(MATH_NEON)
+    uint32_t s[4][4];
+    for (int i = 0; i < 4; i++)
+    {
+        for (int j = 0; j < 4; j++)
+            s[i][j] = lanes[j].s[i];
+    }
+#if defined(MATH_SSE)
+    return { _mm_loadu_si128((const __m128i*)s[0]), _mm_loadu_si128((const __m128i*)s[1]),
+        _mm_loadu_si128((const __m128i*)s[2]), _mm_loadu_si128((const __m128i*)s[3]) };
+#else
+    return { vld1q_u32(s[0]), vld1q_u32(s[1]), vld1q_u32(s[2]), vld1q_u32(s[3]) };
+#endif
+#else
+    return { { lanes[0], lanes[1], lanes[2], lanes[3] } };
+#endif
+}
+
+// Random values in [0, 1), same sequence per lane as NextFloat on the matching Rng
+RMAPI Float4 NextFloat(Rng4* rng)
+{
+#if defined(MATH_SSE)
+    // x * 5 and x * 9 as shift + add (SSE2 has no 32-bit multiply)
+    __m128i x = _mm_add_epi32(_mm_slli_epi32(rng->s1, 2), rng->s1);
+    x = _mm_or_si128(_mm_slli_epi32(x, 7), _mm_srli_epi32(x, 25));
+    __m128i result = _mm_add_epi32(_mm_slli_epi32(x, 3), x);
+    __m128i t = _mm_slli_epi32(rng->s1, 9);
+
+    rng->s2 = _mm_xor_si128(rng->s2, rng->s0);
+    rng->s3 = _mm_xor_si128(rng->s3, rng->s1);
+    rng->s1 = _mm_xor_si128(rng->s1, rng->s2);
+    rng->s0 = _mm_xor_si128(rng->s0, rng->s3);
+    rng->s2 = _mm_xor_si128(rng->s2, t);
+    rng->s3 = _mm_or_si128(_mm_slli_epi32(rng->s3, 11), _mm_srli_epi32(rng->s3, 21));
+
+    return { _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(result, 8)), _mm_set1_ps(1.0f / 16777216.0f)) };
+#elif defined(MATH_NEON)
+    uint32x4_t x = vmulq_n_u32(rng->s1, 5);
+    x = vorrq_u32(vshlq_n_u32(x, 7), vshrq_n_u32(x, 25));
+    uint32x4_t result = vmulq_n_u32(x, 9);
+    uint32x4_t t = vshlq_n_u32(rng->s1, 9);
+
+    rng->s2 = veorq_u32(rng->s2, rng->s0);
+    rng->s3 = veorq_u32(rng->s3, rng->s1);
+    rng->s1 = veorq_u32(rng->s1, rng->s2);
+    rng->s0 = veorq_u32(rng->s0, rng->s3);
+    rng->s2 = veorq_u32(rng->s2, t);
+    rng->s3 = vorrq_u32(vshlq_n_u32(rng->s3, 11), vshrq_n_u32(rng->s3, 21));
+
+    return { vmulq_n_f32(vcvtq_f32_u32(vshrq_n_u32(result, 8)), 1.0f / 16777216.0f) };
+#else
+    float f[4];
+    for (int i = 0; i < 4; i++)
+        f[i] = NextFloat(&rng->lanes[i]);
+    return Float4::Load(f);
+#endif
+}
+
+// Calls fn(rng, begin, end) for every block of [0, count), in parallel if requested
+template<typename Fn> RMAPI void ForEachRandomBlock(uint64_t seed, int count, bool parallel, Fn fn)
+{
+    auto blocks = [&](int first, int last)
+    {
+        for (int block = first; block < last; block++)
+        {
+            Rng4 rng = CreateRng4(seed, block);
+            int begin = block * MATH_RANDOM_BLOCK;
+            int end = count - begin < MATH_RANDOM_BLOCK ? count : begin + MATH_RANDOM_BLOCK;
+            fn(&rng, begin, end);
+        }
+    };
+
+    int blockCount = (count + MATH_RANDOM_BLOCK - 1) / MATH_RANDOM_BLOCK;
+    if (parallel)
+        ParallelFor(blockCount, (MATH_PARALLEL_GRAIN + MATH_RANDOM_BLOCK - 1) / MATH_RANDOM_BLOCK, blocks);
+    else
+        blocks(0, blockCount);
+}
+
+// Fill out with count random values between min and max
+RMAPI void RandomFill(uint64_t seed, float* out, int count, float min, float max, bool parallel = false)
+{
+    ForEachRandomBlock(seed, count, parallel, [&](Rng4* rng, int begin, int end)
+    {
+        for (int i = begin; i < end; i += Float4::Width)
+        {
+            float values[Float4::Width];
+            (Float4::Set(min) + NextFloat(rng) * (max - min)).Store(values);
+            memcpy(out + i, values, (end - i < Float4::Width ? end - i : Float4::Width) * sizeof(float));
+        }
+    });
+}
+
+// Fill out with count uniformly distributed directions
+RMAPI void RandomUnitVectors(uint64_t seed, Vector3* out, int count, bool parallel = false)
+{
+    ForEachRandomBlock(seed, count, parallel, [&](Rng4* rng, int begin, int end)
+    {
+        for (int i = begin; i < end; i += Float4::Width)
+        {
+            // Uniform z in [-1, 1] and uniform angle around z (Archimedes' hat-box theorem)
+            Float4 z = Float4::Set(1.0f) - NextFloat(rng) * 2.0f;
+            Float4 angle = NextFloat(rng) * (2.0f * PI);
+            Float4 r = Sqrt(Max(Float4::Set(0.0f), Float4::Set(1.0f) - z * z));
+            Float4 s, c;
+            SinCos(angle, &s, &c);
+
+            Vector3 v[Float4::Width];
+            Vector3x4{ r * c, r * s, z }.Store(v);
+            memcpy(out + i, v, (end - i < Float4::Width ? end - i : Float4::Width) * sizeof(Vector3));
+        }
+    });
+}
+
+// Fill out with count uniformly distributed rotations
+RMAPI void RandomRotations(uint64_t seed, Quaternion* out, int count, bool parallel = false)
+{
+    ForEachRandomBlock(seed, count, parallel, [&](Rng4* rng, int begin, int end)
+    {
+        for (int i = begin; i < end; i += Float4::Width)
+        {
+            // Shoemake, "Uniform random rotations", Graphics Gems III
+            Float4 u = NextFloat(rng);
+            Float4 a = Sqrt(Float4::Set(1.0f) - u);
+            Float4 b = Sqrt(u);
+            Float4 s1, c1, s2, c2;
+            SinCos(NextFloat(rng) * (2.0f * PI), &s1, &c1);
+            SinCos(NextFloat(rng) * (2.0f * PI), &s2, &c2);
+
+            Quaternion q[Float4::Width];
+            Quaternionx4{ a * s1, a * c1, b * s2, b * c2 }.Store(q);
+            memcpy(out + i, q, (end - i < Float4::Width ? end - i : Float4::Width) * sizeof(Quaternion));
+        }
+    });
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Bulk frustum culling
+//----------------------------------------------------------------------------------
+// Bounds are passed as SoA arrays (one array per component). visible receives the indices of the
+// bounds that pass, in increasing order, and must have room for count indices.
+// Results match SphereInFrustum / AabbInFrustum per element.
+
+// Append the indices of the set lanes of mask (lane i = index first + i) to visible
+RMAPI int CompactIndices(int mask, int first, int lanes, int* visible, int visibleCount)
+{
+    // Branchless: always write, only advance for visible lanes
+    for (int lane = 0; lane < lanes; lane++)
+    {
+        visible[visibleCount] = first + lane;
+        visibleCount += (mask >> lane) & 1;
+    }
+    return visibleCount;
+}
+
+RMAPI int CullSpheresRange(const ViewFrustum& frustum, const float* x, const float* y, const float* z, const float* radius,
+    int begin, int end, int* visible)
+{
+    Float8 nx[6], ny[6], nz[6], nd[6];
+    for (int p = 0; p < 6; p++)
+    {
+        const Plane& plane = frustum.planes[p];
+        nx[p] = Float8::Set(plane.normal.x);
+        ny[p] = Float8::Set(plane.normal.y);
+        nz[p] = Float8::Set(plane.normal.z);
+        nd[p] = Float8::Set(plane.d);
+    }
+
+    int visibleCount = 0;
+    int i = begin;
+    for (; i + Float8::Width <= end; i += Float8::Width)
+    {
+        Float8 cx = Float8::Load(x + i), cy = Float8::Load(y + i), cz = Float8::Load(z + i);
+        Float8 r = -Float8::Load(radius + i);
+
+        Float8 inside = (cx * nx[0] + cy * ny[0] + cz * nz[0] + nd[0]) >= r;
+        for (int p = 1; p < 6; p++)
+            inside = inside & ((cx * nx[p] + cy * ny[p] + cz * nz[p] + nd[p]) >= r);
+
+        int mask = MoveMask(inside);
+        if (mask != 0)
+            visibleCount = CompactIndices(mask, i, Float8::Width, visible, visibleCount);
+    }
+
+    for (; i < end; i++)
+    {
+        visible[visibleCount] = i;
+        visibleCount += SphereInFrustum(frustum, { x[i], y[i], z[i] }, radius[i]) ? 1 : 0;
+    }
+    return visibleCount;
+}
+
+RMAPI int CullAabbsRange(const ViewFrustum& frustum, const float* minX, const float* minY, const float* minZ,
+    const float* maxX, const float* maxY, const float* maxZ, int begin, int end, int* visible)
+{
+    // Furthest corner along each plane normal is picked per plane, so the loop only loads 3 of the 6 arrays
+    const float* cornerX[6]; const float* cornerY[6]; const float* cornerZ[6];
+    for (int p = 0; p < 6; p++)
+    {
+        const Plane& plane = frustum.planes[p];
+        cornerX[p] = plane.normal.x >= 0.0f ? maxX : minX;
+        cornerY[p] = plane.normal.y >= 0.0f ? maxY : minY;
+        cornerZ[p] = plane.normal.z >= 0.0f ? maxZ : minZ;
+    }
+
+    Float8 nx[6], ny[6], nz[6], nd[6];
+    for (int p = 0; p < 6; p++)
+    {
+        const Plane& plane = frustum.planes[p];
+        nx[p] = Float8::Set(plane.normal.x);
+        ny[p] = Float8::Set(plane.normal.y);
+        nz[p] = Float8::Set(plane.normal.z);
+        nd[p] = Float8::Set(plane.d);
+    }
+
+    int visibleCount = 0;
+    int i = begin;
+    for (; i + Float8::Width <= end; i += Float8::Width)
+    {
+        Float8 zero = Float8::Set(0.0f);
+        Float8 inside = (Float8::Load(cornerX[0] + i) * nx[0] + Float8::Load(cornerY[0] + i) * ny[0] + Float8::Load(cornerZ[0] + i) * nz[0] + nd[0]) >= zero;
+        for (int p = 1; p < 6; p++)
+            inside = inside & ((Float8::Load(cornerX[p] + i) * nx[p] + Float8::Load(cornerY[p] + i) * ny[p] + Float8::Load(cornerZ[p] + i) * nz[p] + nd[p]) >= zero);
+
+        int mask = MoveMask(inside);
+        if (mask != 0)
+            visibleCount = CompactIndices(mask, i, Float8::Width, visible, visibleCount);
+    }
+
+    for (; i < end; i++)
+    {
+        visible[visibleCount] = i;
+        visibleCount += AabbInFrustum(frustum, { minX[i], minY[i], minZ[i] }, { maxX[i], maxY[i], maxZ[i] }) ? 1 : 0;
+    }
+    return visibleCount;
+}
+
+// Runs cull(begin, end, visible + begin) over fixed-size chunks, then packs the per-chunk results together
+template<typename Fn> RMAPI int CullChunks(int count, bool parallel, int* visible, Fn cull)
+{
+    if (!parallel)
+        return cull(0, count, visible);
+
+    const int chunk = MATH_PARALLEL_GRAIN;
+    int chunks = (count + chunk - 1) / chunk;
+    std::vector<int> counts(chunks);
+    ParallelFor(chunks, 1, [&](int first, int last)
+    {
+        for (int c = first; c < last; c++)
+        {
+            int begin = c * chunk;
+            int end = count - begin < chunk ? count : begin + chunk;
+            counts[c] = cull(begin, end, visible + begin);
+        }
+    });
+
+    int visibleCount = counts.empty() ? 0 : counts[0];
+    for (int c = 1; c < chunks; c++)
+    {
+        memmove(visible + visibleCount, visible + c * chunk, counts[c] * sizeof(int));
+        visibleCount += counts[c];
+    }
+    return visibleCount;
+}
+
+// Cull count bounding spheres, returns the number of visible indices written
+RMAPI int CullSpheres(const ViewFrustum& frustum, const float* x, const float* y, const float* z, const float* radius,
+    int count, int* visible, bool parallel = false)
+{
+    return CullChunks(count, parallel, visible, [&](int begin, int end, int* out)
+    {
+        return CullSpheresRange(frustum, x, y, z, radius, begin, end, out);
+    });
+}
+
+// Cull count axis-aligned boxes, returns the number of visible indices written
+RMAPI int CullAabbs(const ViewFrustum& frustum, const float* minX, const float* minY, const float* minZ,
+    const float* maxX, const float* maxY, const float* maxZ, int count, int* visible, bool parallel = false)
+{
+    return CullChunks(count, parallel, visible, [&](int begin, int end, int* out)
+    {
+        return CullAabbsRange(frustum, minX, minY, minZ, maxX, maxY, maxZ, begin, end, out);
+    });
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - SoA transforms
+//----------------------------------------------------------------------------------
+
+// Same as the Vector3 TransformVectors for vectors stored as separate x, y and z arrays. Needs no shuffles, so it's the
+// vectorized path for arrays that are transformed often. Outputs may alias the inputs.
+RMAPI void TransformVectors(Matrix mat, const float* x, const float* y, const float* z, float* outX, float* outY, float* outZ,
+    int count, float w)
+{
+    Float8 m0 = Float8::Set(mat.m0), m4 = Float8::Set(mat.m4), m8 = Float8::Set(mat.m8), m12 = Float8::Set(mat.m12 * w);
+    Float8 m1 = Float8::Set(mat.m1), m5 = Float8::Set(mat.m5), m9 = Float8::Set(mat.m9), m13 = Float8::Set(mat.m13 * w);
+    Float8 m2 = Float8::Set(mat.m2), m6 = Float8::Set(mat.m6), m10 = Float8::Set(mat.m10), m14 = Float8::Set(mat.m14 * w);
+    int i = 0;
+    for (; i + Float8::Width <= count; i += Float8::Width)
+    {
+        Float8 vx = Float8::Load(x + i), vy = Float8::Load(y + i), vz = Float8::Load(z + i);
+        (m0 * vx + m4 * vy + m8 * vz + m12).Store(outX + i);
+        (m1 * vx + m5 * vy + m9 * vz + m13).Store(outY + i);
+        (m2 * vx + m6 * vy + m10 * vz + m14).Store(outZ + i);
+    }
+
+    for (; i < count; i++)
+    {
+        float vx = x[i], vy = y[i], vz = z[i];
+        outX[i] = mat.m0 * vx + mat.m4 * vy + mat.m8 * vz + mat.m12 * w;
+        outY[i] = mat.m1 * vx + mat.m5 * vy + mat.m9 * vz + mat.m13 * w;
+        outZ[i] = mat.m2 * vx + mat.m6 * vy + mat.m10 * vz + mat.m14 * w;
+    }
+}
+
+// SoA TransformPoints (same results as the Vector3 version)
+RMAPI void TransformPoints(Matrix mat, const float* x, const float* y, const float* z, float* outX, float* outY, float* outZ,
+    int count, bool parallel = false)
+{
+    if (parallel)
+    {
+        ParallelFor(count, MATH_PARALLEL_GRAIN, [&](int begin, int end)
+        {
+            TransformVectors(mat, x + begin, y + begin, z + begin, outX + begin, outY + begin, outZ + begin, end - begin, 1.0f);
+        });
+    }
+    else
+        TransformVectors(mat, x, y, z, outX, outY, outZ, count, 1.0f);
+}
+
+// SoA TransformDirections (same results as the Vector3 version)
+RMAPI void TransformDirections(Matrix mat, const float* x, const float* y, const float* z, float* outX, float* outY, float* outZ,
+    int count, bool parallel = false)
+{
+    if (parallel)
+    {
+        ParallelFor(count, MATH_PARALLEL_GRAIN, [&](int begin, int end)
+        {
+            TransformVectors(mat, x + begin, y + begin, z + begin, outX + begin, outY + begin, outZ + begin, end - begin, 0.0f);
+        });
+    }
+    else
+        TransformVectors(mat, x, y, z, outX, outY, outZ, count, 0.0f);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Bulk bounds transforms
+//----------------------------------------------------------------------------------
+// Transform one object-space bound by count world matrices (ie an instanced set) into SoA arrays
+// that CullSpheres / CullAabbs take directly. Results match Multiply + MaxAxisScale / TransformAabb per element.
+
+RMAPI void TransformSpheresRange(const Matrix* worlds, Vector3 center, float radius,
+    float* x, float* y, float* z, float* radii, int begin, int end)
+{
+    Vector3Wide<Float8> c = Vector3Wide<Float8>::Set(center);
+    int i = begin;
+    for (; i + Float8::Width <= end; i += Float8::Width)
+    {
+        MatrixWide<Float8> m = MatrixWide<Float8>::Load(worlds + i);
+        Vector3Wide<Float8> p = Multiply(c, m);
+        Float8 sx = m.m0 * m.m0 + m.m1 * m.m1 + m.m2 * m.m2;
+        Float8 sy = m.m4 * m.m4 + m.m5 * m.m5 + m.m6 * m.m6;
+        Float8 sz = m.m8 * m.m8 + m.m9 * m.m9 + m.m10 * m.m10;
+
+        p.x.Store(x + i);
+        p.y.Store(y + i);
+        p.z.Store(z + i);
+        (Sqrt(Max(sx, Max(sy, sz))) * radius).Store(radii + i);
+    }
+
+    for (; i < end; i++)
+    {
+        Vector3 p = Multiply(center, worlds[i]);
+        x[i] = p.x;
+        y[i] = p.y;
+        z[i] = p.z;
+        radii[i] = MaxAxisScale(worlds[i]) * radius;
+    }
+}
+
+RMAPI void TransformAabbsRange(const Matrix* worlds, Vector3 min, Vector3 max,
+    float* minX, float* minY, float* minZ, float* maxX, float* maxY, float* maxZ, int begin, int end)
+{
+    Vector3Wide<Float8> c = Vector3Wide<Float8>::Set((min + max) * 0.5f);
+    Vector3 half = (max - min) * 0.5f;
+    Float8 hx = Float8::Set(half.x), hy = Float8::Set(half.y), hz = Float8::Set(half.z);
+    int i = begin;
+    for (; i + Float8::Width <= end; i += Float8::Width)
+    {
+        MatrixWide<Float8> m = MatrixWide<Float8>::Load(worlds + i);
+        Vector3Wide<Float8> p = Multiply(c, m);
+        Float8 ex = Abs(m.m0) * hx + Abs(m.m4) * hy + Abs(m.m8) * hz;
+        Float8 ey = Abs(m.m1) * hx + Abs(m.m5) * hy + Abs(m.m9) * hz;
+        Float8 ez = Abs(m.m2) * hx + Abs(m.m6) * hy + Abs(m.m10) * hz;
+
+        (p.x - ex).Store(minX + i);
+        (p.y - ey).Store(minY + i);
+        (p.z - ez).Store(minZ + i);
+        (p.x + ex).Store(maxX + i);
+        (p.y + ey).Store(maxY + i);
+        (p.z + ez).Store(maxZ + i);
+    }
+
+    for (; i < end; i++)
+    {
+        Vector3 lo, hi;
+        TransformAabb(worlds[i], min, max, &lo, &hi);
+        minX[i] = lo.x; minY[i] = lo.y; minZ[i] = lo.z;
+        maxX[i] = hi.x; maxY[i] = hi.y; maxZ[i] = hi.z;
+    }
+}
+
+// World-space bounding spheres of count instances of a sphere
+RMAPI void TransformSpheres(const Matrix* worlds, int count, Vector3 center, float radius,
+    float* x, float* y, float* z, float* radii, bool parallel = false)
+{
+    if (parallel)
+    {
+        ParallelFor(count, MATH_PARALLEL_GRAIN, [&](int begin, int end)
+        {
+            TransformSpheresRange(worlds, center, radius, x, y, z, radii, begin, end);
+        });
+    }
+    else
+        TransformSpheresRange(worlds, center, radius, x, y, z, radii, 0, count);
+}
+
+// World-space axis-aligned boxes of count instances of a box
+RMAPI void TransformAabbs(const Matrix* worlds, int count, Vector3 min, Vector3 max,
+    float* minX, float* minY, float* minZ, float* maxX, float* maxY, float* maxZ, bool parallel = false)
+{
+    if (parallel)
+    {
+        ParallelFor(count, MATH_PARALLEL_GRAIN, [&](int begin, int end)
+        {
+            TransformAabbsRange(worlds, min, max, minX, minY, minZ, maxX, maxY, maxZ, begin, end);
+        });
+    }
+    else
+        TransformAabbsRange(worlds, min, max, minX, minY, minZ, maxX, maxY, maxZ, 0, count);
+}
@@ -1,63 +1,150 @@
 #define PAR_SHAPES_IMPLEMENTATION
-#define FAST_OBJ_IMPLEMENTATION
 #include <par_shapes.h>
-#include <fast_obj.h>
 #include "Mesh.h"
+#include "GeometryArena.h"
+#include "MeshCache.h"
+#include "MeshOptimizer.h"
+#include "MeshSimplifier.h"
+#include "Meshlets.h"
+#include "ObjLoader.h"
+#include "Parallel.h"
 #include <cassert>
+#include <cmath>
+#include <cstddef>
 #include <cstdio>
+#include <cstdlib>
 
-void Upload(Mesh* mesh);
+void SplitIndices16(Mesh* mesh);
+
+// Vertex array the draw functions last bound, so redundant binds can be skipped
+static GLuint gVertexArray = GL_NONE;
 
 void GenCube(Mesh* mesh, float width, float height, float length);
 
-void CreateMesh(Mesh* mesh, const char* path)
+// Welds identical position/normal/tcoord index triples into shared vertices.
+// Writes one vertex index per corner to indices and returns the unique triples in first-use order.
+// Open addressing with linear probing keeps this O(n) with no per-vertex allocations.
+static std::vector<ObjCorner> WeldVertices(const ObjCorner* corners, int count, std::vector<uint32_t>* indices)
 {
-	fastObjMesh* obj = fast_obj_read(path);
-	int count = obj->index_count;
-	mesh->positions.resize(count);
-	mesh->normals.resize(count);
-	std::vector<fastObjIndex> indices(obj->index_count);
-	memcpy(indices.data(), obj->indices, indices.size() * sizeof(fastObjIndex));
-	
-	assert(obj->position_count > 1);
-	for (int i = 0; i < count; i++)
-	{
-		// Using the obj file's indices, populate the mesh->positions with the object's vertex positions
-		fastObjIndex idx = obj->indices[i];
-		Vector3 position = ((Vector3*)obj->positions)[idx.p];
-		mesh->positions[i] = position;
-	}
-	
-	assert(obj->normal_count > 1);
+	const uint32_t EMPTY = 0xFFFFFFFF;
+	uint32_t capacity = 64;
+	while (capacity < (uint32_t)count * 2)
+		capacity *= 2;
+
+	std::vector<uint32_t> table(capacity, EMPTY);
+	std::vector<ObjCorner> unique;
+	unique.reserve(count / 3 + 1);
+	indices->resize(count);
+
 	for (int i = 0; i < count; i++)
 	{
-		// Using the obj file's indices, populate the mesh->normals with the object's vertex normals
-		fastObjIndex idx = obj->indices[i];
-		Vector3 normal = ((Vector3*)obj->normals)[idx.n];
-		mesh->normals[i] = normal;
-	}
-	
-	if (obj->texcoord_count > 1)
-	{
-		mesh->tcoords.resize(count);
-		for (int i = 0; i < count; i++)
+		ObjCorner corner = corners[i];
+		uint32_t hash = (corner.p * 73856093u) ^ (corner.n * 19349663u) ^ (corner.t * 83492791u);
+		uint32_t slot = hash & (capacity - 1);
+		for (;;)
 		{
-			// Using the obj file's indices, populate the mesh->tcoords with the object's vertex texture coordinates
-			fastObjIndex idx = obj->indices[i];
-			Vector2 tcoord = ((Vector2*)obj->texcoords)[idx.t];
-			mesh->tcoords[i] = tcoord;
+			uint32_t vertex = table[slot];
+			if (vertex == EMPTY)
+			{
+				vertex = (uint32_t)unique.size();
+				table[slot] = vertex;
+				unique.push_back(corner);
+				(*indices)[i] = vertex;
+				break;
+			}
+
+			ObjCorner other = unique[vertex];
+			if (other.p == corner.p && other.n == corner.n && other.t == corner.t)
+			{
+				(*indices)[i] = vertex;
+				break;
+			}
+			slot = (slot + 1) & (capacity - 1);
 		}
 	}
-	else
+
+	return unique;
+}
+
+// Parses the obj and welds its corners into indexed vertices. Returns false (leaving the mesh untouched) if the obj can't be read.
+static bool LoadObj(Mesh* mesh, const char* path)
+{
+	ObjData obj;
+	if (!ReadObj(path, &obj))
+	{
+		printf("**Error: could not read obj file %s**\n", path);
+		DestroyObj(&obj);
+		return false;
+	}
+
+	int count = (int)obj.cornerCount;
+	assert(obj.positionCount > 1);
+	assert(obj.normalCount > 1);
+
+	bool hasTcoords = obj.tcoordCount > 1;
+	if (!hasTcoords)
 	{
 		printf("**Warning: mesh %s loaded without texture coordinates**\n", path);
 	}
-	fast_obj_destroy(obj);
+
+	std::vector<uint32_t> indices;
+	std::vector<ObjCorner> vertices = WeldVertices(obj.corners, count, &indices);
+	int vertexCount = (int)vertices.size();
+	printf("Mesh %s: welded %d corners into %d vertices (%.2fx fewer)\n", path, count, vertexCount, (float)count / (float)vertexCount);
+
+	// Using the welded obj indices, populate the mesh's vertex attributes
+	mesh->positions.resize(vertexCount);
+	mesh->normals.resize(vertexCount);
+	mesh->tcoords.resize(hasTcoords ? vertexCount : 0);
+	ParallelFor(vertexCount, 65536, [&](int begin, int end)
+	{
+		for (int i = begin; i < end; i++)
+		{
+			ObjCorner idx = vertices[i];
+			mesh->positions[i] = obj.positions[idx.p];
+			mesh->normals[i] = obj.normals[idx.n];
+			if (hasTcoords)
+				mesh->tcoords[i] = obj.tcoords[idx.t];
+		}
+	});
+	DestroyObj(&obj);
+
+	mesh->indices = std::move(indices);
 	mesh->count = count;
+	return true;
+}
 
+void CreateMesh(Mesh* mesh, const char* path, IndexFormat format)
+{
+	LoadMesh(mesh, path, format);
 	Upload(mesh);
 }
 
+void LoadMesh(Mesh* mesh, const char* path, IndexFormat format)
+{
+	// Cooked meshes are already welded & optimized and carry their bounds, so only parse when the cache is missing or stale
+	if (!LoadMeshCache(mesh, path) && !CookMesh(mesh, path) && mesh->indices.empty())
+	{
+		// Nothing to draw, and every caller expects geometry
+		printf("**Error: mesh %s could not be loaded**\n", path);
+		abort();
+	}
+
+	if (format == INDEX_SPLIT_16)
+		SplitIndices16(mesh);
+}
+
+bool CookMesh(Mesh* mesh, const char* path)
+{
+	if (!LoadObj(mesh, path))
+		return false;
+	OptimizeMesh(mesh, path);
+	BuildMeshlets(mesh, path);
+	GenerateLods(mesh, path);
+	ComputeBounds(mesh);
+	return SaveMeshCache(*mesh, path);
+}
+
 void CreateMesh(Mesh* mesh, ShapeType shape)
 {
 	// 1. Generate par_shapes_mesh
@@ -89,8 +176,7 @@ void CreateMesh(Mesh* mesh, ShapeType shape)
 		// 2. Convert par_shapes_mesh to our Mesh representation
 		int count = par->ntriangles * 3;	// 3 points per triangle
 		mesh->count = count;
-		mesh->indices.resize(count);
-		memcpy(mesh->indices.data(), par->triangles, count * sizeof(uint16_t));
+		mesh->indices.assign(par->triangles, par->triangles + count);
 		mesh->positions.resize(par->npoints);
 		memcpy(mesh->positions.data(), par->points, par->npoints * sizeof(Vector3));
 		mesh->normals.resize(par->npoints);
@@ -98,6 +184,7 @@ void CreateMesh(Mesh* mesh, ShapeType shape)
 		mesh->tcoords.resize(par->npoints);
 		memcpy(mesh->tcoords.data(), par->tcoords, par->npoints * sizeof(Vector2));
 		par_shapes_free_mesh(par);
+		ComputeBounds(mesh);
 	}
 	else
 	{
@@ -109,8 +196,83 @@ void CreateMesh(Mesh* mesh, ShapeType shape)
 	Upload(mesh);
 }
 
+void ComputeBounds(Mesh* mesh)
+{
+	const std::vector<Vector3>& positions = mesh->positions;
+	if (positions.empty())
+	{
+		mesh->boundsMin = mesh->boundsMax = mesh->sphereCenter = V3_ZERO;
+		mesh->sphereRadius = 0.0f;
+		return;
+	}
+
+	// Box, plus the points furthest along each axis to seed the sphere
+	Vector3 min = positions[0], max = positions[0];
+	int extremes[6] = {};
+	for (int i = 1; i < (int)positions.size(); i++)
+	{
+		Vector3 p = positions[i];
+		for (int axis = 0; axis < 3; axis++)
+		{
+			float value = (&p.x)[axis];
+			if (value < (&min.x)[axis])
+			{
+				(&min.x)[axis] = value;
+				extremes[axis * 2] = i;
+			}
+			if (value > (&max.x)[axis])
+			{
+				(&max.x)[axis] = value;
+				extremes[axis * 2 + 1] = i;
+			}
+		}
+	}
+	mesh->boundsMin = min;
+	mesh->boundsMax = max;
+
+	// Ritter's sphere: start from the most distant pair of extremes, then grow to enclose every point
+	int axis = 0;
+	for (int a = 1; a < 3; a++)
+	{
+		if (LengthSqr(positions[extremes[a * 2 + 1]] - positions[extremes[a * 2]]) >
+			LengthSqr(positions[extremes[axis * 2 + 1]] - positions[extremes[axis * 2]]))
+			axis = a;
+	}
+
+	Vector3 center = (positions[extremes[axis * 2]] + positions[extremes[axis * 2 + 1]]) * 0.5f;
+	float radius = Length(positions[extremes[axis * 2 + 1]] - center);
+	for (Vector3 p : positions)
+	{
+		float distance = Length(p - center);
+		if (distance > radius)
+		{
+			float grown = (radius + distance) * 0.5f;
+			center = center + (p - center) * ((grown - radius) / distance);
+			radius = grown;
+		}
+	}
+
+	// Ritter is usually tighter, but the box's circumsphere wins on some shapes (ie boxes)
+	Vector3 boxCenter = (min + max) * 0.5f;
+	float boxRadius = 0.0f;
+	for (Vector3 p : positions)
+		boxRadius = Max(boxRadius, Length(p - boxCenter));
+
+	mesh->sphereCenter = boxRadius < radius ? boxCenter : center;
+	mesh->sphereRadius = Min(boxRadius, radius);
+}
+
 void DestroyMesh(Mesh* mesh)
 {
+	// Arena meshes keep their arena, so uploading them again (ie after a streaming eviction) returns them to it
+	if (mesh->arena != nullptr)
+	{
+		RemoveFromArena(mesh->arena, mesh);
+		return;
+	}
+
+	if (mesh->vao != GL_NONE && mesh->vao == gVertexArray)
+		gVertexArray = GL_NONE;
 	glDeleteBuffers(1, &mesh->ebo);
 	glDeleteBuffers(1, &mesh->tbo);
 	glDeleteBuffers(1, &mesh->nbo);
@@ -120,62 +282,337 @@ void DestroyMesh(Mesh* mesh)
 	mesh->vao = mesh->pbo = mesh->nbo = mesh->tbo = mesh->ebo = GL_NONE;
 }
 
-void DrawMesh(const Mesh& mesh)
+void BindVertexArray(GLuint vao)
+{
+	if (vao != gVertexArray)
+	{
+		glBindVertexArray(vao);
+		gVertexArray = vao;
+	}
+}
+
+void GetLodRange(const Mesh& mesh, int lod, int* first, int* count)
 {
-	glBindVertexArray(mesh.vao);
-	if (mesh.ebo != GL_NONE)
-		glDrawElements(GL_TRIANGLES, mesh.count, GL_UNSIGNED_SHORT, nullptr);
+	*first = mesh.indexBlock.offset;
+	*count = mesh.count;
+	if (lod > 0 && !mesh.lods.empty())
+	{
+		const MeshLod& level = mesh.lods[Min(lod, (int)mesh.lods.size() - 1)];
+		*first += level.offset;
+		*count = level.count;
+	}
+}
+
+// Index count & byte offset of a LOD within the element buffer
+static void LodRange(const Mesh& mesh, int lod, int* count, const void** offset)
+{
+	size_t indexSize = mesh.indexType == GL_UNSIGNED_INT ? sizeof(uint32_t) : sizeof(uint16_t);
+	int first;
+	GetLodRange(mesh, lod, &first, count);
+	*offset = (const void*)(first * indexSize);
+}
+
+// Arena meshes leave the shared VAO bound, so a run of them binds it once. Other meshes unbind theirs as before.
+static GLuint MeshVertexArray(const Mesh& mesh)
+{
+	return mesh.arena != nullptr ? mesh.arena->vao : mesh.vao;
+}
+
+static void EndDraw(const Mesh& mesh)
+{
+	if (mesh.arena == nullptr)
+		BindVertexArray(GL_NONE);
+}
+
+void DrawMesh(const Mesh& mesh, int lod)
+{
+	BindVertexArray(MeshVertexArray(mesh));
+	size_t indexSize = mesh.indexType == GL_UNSIGNED_INT ? sizeof(uint32_t) : sizeof(uint16_t);
+	if (!mesh.ranges.empty())
+	{
+		for (const MeshRange& range : mesh.ranges)
+			glDrawElementsBaseVertex(GL_TRIANGLES, range.count, mesh.indexType,
+				(const void*)((mesh.indexBlock.offset + range.offset) * indexSize), mesh.vertexBlock.offset + range.baseVertex);
+	}
+	else if (mesh.ebo != GL_NONE || mesh.arena != nullptr)
+	{
+		int count;
+		const void* offset;
+		LodRange(mesh, lod, &count, &offset);
+		glDrawElementsBaseVertex(GL_TRIANGLES, count, mesh.indexType, offset, mesh.vertexBlock.offset);
+	}
 	else
 		glDrawArrays(GL_TRIANGLES, 0, mesh.count);
-	glBindVertexArray(GL_NONE);
+	EndDraw(mesh);
 }
 
-void DrawMeshInstanced(const Mesh& mesh, int instanceCount)
+void DrawMeshInstanced(const Mesh& mesh, int instanceCount, int lod)
 {
-	glBindVertexArray(mesh.vao);
-	if (mesh.ebo != GL_NONE)
-		glDrawElementsInstanced(GL_TRIANGLES, mesh.count, GL_UNSIGNED_SHORT, nullptr, instanceCount);
+	BindVertexArray(MeshVertexArray(mesh));
+	size_t indexSize = mesh.indexType == GL_UNSIGNED_INT ? sizeof(uint32_t) : sizeof(uint16_t);
+	if (!mesh.ranges.empty())
+	{
+		for (const MeshRange& range : mesh.ranges)
+			glDrawElementsInstancedBaseVertex(GL_TRIANGLES, range.count, mesh.indexType,
+				(const void*)((mesh.indexBlock.offset + range.offset) * indexSize), instanceCount, mesh.vertexBlock.offset + range.baseVertex);
+	}
+	else if (mesh.ebo != GL_NONE || mesh.arena != nullptr)
+	{
+		int count;
+		const void* offset;
+		LodRange(mesh, lod, &count, &offset);
+		glDrawElementsInstancedBaseVertex(GL_TRIANGLES, count, mesh.indexType, offset, instanceCount, mesh.vertexBlock.offset);
+	}
 	else
 		glDrawArraysInstanced(GL_TRIANGLES, 0, mesh.count, instanceCount);
-	glBindVertexArray(GL_NONE);
+	EndDraw(mesh);
+}
+
+void DrawMeshlets(const Mesh& mesh, const int* meshlets, int count)
+{
+	assert(mesh.ranges.empty() && (mesh.ebo != GL_NONE || mesh.arena != nullptr), "Meshlets need an indexed mesh without 16-bit ranges");
+	if (count == 0)
+		return;
+
+	// Only called on the GL thread, so the scratch arrays can be reused between calls
+	static std::vector<GLsizei> counts;
+	static std::vector<const void*> offsets;
+	static std::vector<GLint> baseVertices;
+	counts.clear();
+	offsets.clear();
+
+	// Neighbouring survivors are contiguous in the element buffer, so merge them into one draw
+	size_t indexSize = mesh.indexType == GL_UNSIGNED_INT ? sizeof(uint32_t) : sizeof(uint16_t);
+	int end = -1;
+	for (int i = 0; i < count; i++)
+	{
+		const Meshlet& meshlet = mesh.meshlets[meshlets[i]];
+		if (meshlet.offset == end)
+			counts.back() += meshlet.count;
+		else
+		{
+			counts.push_back(meshlet.count);
+			offsets.push_back((const void*)((mesh.indexBlock.offset + meshlet.offset) * indexSize));
+		}
+		end = meshlet.offset + meshlet.count;
+	}
+	baseVertices.assign(counts.size(), mesh.vertexBlock.offset);
+
+	BindVertexArray(MeshVertexArray(mesh));
+	glMultiDrawElementsBaseVertex(GL_TRIANGLES, counts.data(), mesh.indexType, offsets.data(), (GLsizei)counts.size(), baseVertices.data());
+	EndDraw(mesh);
+}
+
+void Interleave(const Mesh& mesh, std::vector<Vertex>* vertices, bool parallel)
+{
+	int count = (int)mesh.positions.size();
+	bool hasTcoords = !mesh.tcoords.empty();
+	vertices->resize(count);
+	Vertex* out = vertices->data();
+
+	auto interleave = [&](int begin, int end)
+	{
+		for (int i = begin; i < end; i++)
+		{
+			out[i].position = mesh.positions[i];
+			out[i].normal = mesh.normals[i];
+			out[i].tcoord = hasTcoords ? mesh.tcoords[i] : Vector2{ 0.0f, 0.0f };
+		}
+	};
+
+	if (parallel)
+		ParallelFor(count, 16384, interleave);
+	else
+		interleave(0, count);
+}
+
+// Round-to-nearest float to half conversion. Overflow becomes infinity, tiny values flush through subnormals to zero.
+static uint16_t HalfFromFloat(float value)
+{
+	uint32_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	uint32_t sign = (bits >> 16) & 0x8000;
+	uint32_t mantissa = bits & 0x7FFFFF;
+	int exponent = (int)((bits >> 23) & 0xFF) - 127 + 15;
+
+	if (((bits >> 23) & 0xFF) == 0xFF)
+		return (uint16_t)(sign | 0x7C00 | (mantissa != 0 ? 0x200 : 0));
+	if (exponent >= 31)
+		return (uint16_t)(sign | 0x7C00);
+	if (exponent <= 0)
+	{
+		if (exponent < -10)
+			return (uint16_t)sign;
+		mantissa |= 0x800000;
+		int shift = 14 - exponent;
+		uint32_t half = mantissa >> shift;
+		if ((mantissa >> (shift - 1)) & 1)
+			half++;
+		return (uint16_t)(sign | half);
+	}
+
+	// A rounding carry out of the mantissa correctly bumps the exponent
+	uint32_t half = sign | ((uint32_t)exponent << 10) | (mantissa >> 13);
+	if (mantissa & 0x1000)
+		half++;
+	return (uint16_t)half;
+}
+
+// Projects the unit normal onto an octahedron, then unfolds the lower half over the upper
+static void OctEncode(Vector3 n, int16_t* out)
+{
+	float sum = Abs(n.x) + Abs(n.y) + Abs(n.z);
+	float x = sum > 0.0f ? n.x / sum : 0.0f;
+	float y = sum > 0.0f ? n.y / sum : 0.0f;
+	if (n.z < 0.0f)
+	{
+		float ox = x;
+		x = (1.0f - Abs(y)) * (ox >= 0.0f ? 1.0f : -1.0f);
+		y = (1.0f - Abs(ox)) * (y >= 0.0f ? 1.0f : -1.0f);
+	}
+	out[0] = (int16_t)std::lround(Clamp(x, -1.0f, 1.0f) * 32767.0f);
+	out[1] = (int16_t)std::lround(Clamp(y, -1.0f, 1.0f) * 32767.0f);
+}
+
+void Quantize(const Mesh& mesh, std::vector<PackedVertex>* vertices, Matrix* dequantize, bool parallel)
+{
+	int count = (int)mesh.positions.size();
+	bool hasTcoords = !mesh.tcoords.empty();
+	vertices->resize(count);
+	PackedVertex* out = vertices->data();
+
+	Vector3 min = count > 0 ? mesh.positions[0] : Vector3{ 0.0f, 0.0f, 0.0f };
+	Vector3 max = min;
+	for (Vector3 p : mesh.positions)
+	{
+		min = { Min(min.x, p.x), Min(min.y, p.y), Min(min.z, p.z) };
+		max = { Max(max.x, p.x), Max(max.y, p.y), Max(max.z, p.z) };
+	}
+
+	// Flat axes still need a non-zero scale to divide by
+	Vector3 extent = max - min;
+	extent = { extent.x > 0.0f ? extent.x : 1.0f, extent.y > 0.0f ? extent.y : 1.0f, extent.z > 0.0f ? extent.z : 1.0f };
+	*dequantize = Scale(extent) * Translate(min);
+
+	auto quantize = [&](int begin, int end)
+	{
+		for (int i = begin; i < end; i++)
+		{
+			Vector3 p = (mesh.positions[i] - min) / extent;
+			out[i].position[0] = (uint16_t)std::lround(Clamp(p.x, 0.0f, 1.0f) * 65535.0f);
+			out[i].position[1] = (uint16_t)std::lround(Clamp(p.y, 0.0f, 1.0f) * 65535.0f);
+			out[i].position[2] = (uint16_t)std::lround(Clamp(p.z, 0.0f, 1.0f) * 65535.0f);
+			out[i].position[3] = 0;
+			OctEncode(mesh.normals[i], out[i].normal);
+			out[i].tcoord[0] = hasTcoords ? HalfFromFloat(mesh.tcoords[i].x) : 0;
+			out[i].tcoord[1] = hasTcoords ? HalfFromFloat(mesh.tcoords[i].y) : 0;
+		}
+	};
+
+	if (parallel)
+		ParallelFor(count, 16384, quantize);
+	else
+		quantize(0, count);
 }
 
 void Upload(Mesh* mesh)
 {
+	if (mesh->arena != nullptr)
+	{
+		AddToArena(mesh->arena, mesh);
+		return;
+	}
+
 	GLuint vao, pbo, nbo, tbo, ebo;
 	vao = pbo = nbo = tbo = ebo = GL_NONE;
 	glGenVertexArrays(1, &vao);
-	glBindVertexArray(vao);
+	BindVertexArray(vao);
 	
-	glGenBuffers(1, &pbo);
-	glBindBuffer(GL_ARRAY_BUFFER, pbo);
-	glBufferData(GL_ARRAY_BUFFER, mesh->positions.size() * sizeof(Vector3), mesh->positions.data(), GL_STATIC_DRAW);
-	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vector3), nullptr);
-	glEnableVertexAttribArray(0);
-
-	glGenBuffers(1, &nbo);
-	glBindBuffer(GL_ARRAY_BUFFER, nbo);
-	glBufferData(GL_ARRAY_BUFFER, mesh->normals.size() * sizeof(Vector3), mesh->normals.data(), GL_STATIC_DRAW);
-	glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vector3), nullptr);
-	glEnableVertexAttribArray(1);
-
-	if (!mesh->tcoords.empty())
-	{
-		glGenBuffers(1, &tbo);
-		glBindBuffer(GL_ARRAY_BUFFER, tbo);
-		glBufferData(GL_ARRAY_BUFFER, mesh->tcoords.size() * sizeof(Vector2), mesh->tcoords.data(), GL_STATIC_DRAW);
-		glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vector2), nullptr);
-		glEnableVertexAttribArray(2);
+	if (mesh->layout == LAYOUT_INTERLEAVED)
+	{
+		std::vector<Vertex> vertices;
+		Interleave(*mesh, &vertices, mesh->positions.size() >= 65536);
+
+		glGenBuffers(1, &pbo);
+		glBindBuffer(GL_ARRAY_BUFFER, pbo);
+		glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex), vertices.data(), GL_STATIC_DRAW);
+		glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (const void*)offsetof(Vertex, position));
+		glEnableVertexAttribArray(0);
+		glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (const void*)offsetof(Vertex, normal));
+		glEnableVertexAttribArray(1);
+		if (!mesh->tcoords.empty())
+		{
+			glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (const void*)offsetof(Vertex, tcoord));
+			glEnableVertexAttribArray(2);
+		}
 	}
-	
+	else if (mesh->layout == LAYOUT_QUANTIZED)
+	{
+		std::vector<PackedVertex> vertices;
+		Quantize(*mesh, &vertices, &mesh->dequantize, mesh->positions.size() >= 65536);
+
+		glGenBuffers(1, &pbo);
+		glBindBuffer(GL_ARRAY_BUFFER, pbo);
+		glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(PackedVertex), vertices.data(), GL_STATIC_DRAW);
+		glVertexAttribPointer(0, 3, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(PackedVertex), (const void*)offsetof(PackedVertex, position));
+		glEnableVertexAttribArray(0);
+		glVertexAttribPointer(1, 2, GL_SHORT, GL_TRUE, sizeof(PackedVertex), (const void*)offsetof(PackedVertex, normal));
+		glEnableVertexAttribArray(1);
+		if (!mesh->tcoords.empty())
+		{
+			glVertexAttribPointer(2, 2, GL_HALF_FLOAT, GL_FALSE, sizeof(PackedVertex), (const void*)offsetof(PackedVertex, tcoord));
+			glEnableVertexAttribArray(2);
+		}
+	}
+	else
+	{
+		glGenBuffers(1, &pbo);
+		glBindBuffer(GL_ARRAY_BUFFER, pbo);
+		glBufferData(GL_ARRAY_BUFFER, mesh->positions.size() * sizeof(Vector3), mesh->positions.data(), GL_STATIC_DRAW);
+		glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vector3), nullptr);
+		glEnableVertexAttribArray(0);
+
+		glGenBuffers(1, &nbo);
+		glBindBuffer(GL_ARRAY_BUFFER, nbo);
+		glBufferData(GL_ARRAY_BUFFER, mesh->normals.size() * sizeof(Vector3), mesh->normals.data(), GL_STATIC_DRAW);
+		glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vector3), nullptr);
+		glEnableVertexAttribArray(1);
+
+		if (!mesh->tcoords.empty())
+		{
+			glGenBuffers(1, &tbo);
+			glBindBuffer(GL_ARRAY_BUFFER, tbo);
+			glBufferData(GL_ARRAY_BUFFER, mesh->tcoords.size() * sizeof(Vector2), mesh->tcoords.data(), GL_STATIC_DRAW);
+			glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vector2), nullptr);
+			glEnableVertexAttribArray(2);
+		}
+	}
+
 	if (!mesh->indices.empty())
 	{
+		// Split meshes already hold range-relative indices, so they always fit in 16 bits
+		bool wide = mesh->ranges.empty() && mesh->positions.size() > 65536;
+		mesh->indexType = wide ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT;
+
+		// Coarser LODs follow the full mesh in the same buffer
+		size_t count = mesh->indices.size() + mesh->lodIndices.size();
 		glGenBuffers(1, &ebo);
 		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
-		glBufferData(GL_ELEMENT_ARRAY_BUFFER, mesh->indices.size() * sizeof(uint16_t), mesh->indices.data(), GL_STATIC_DRAW);
+		if (wide)
+		{
+			glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(uint32_t), nullptr, GL_STATIC_DRAW);
+			glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, mesh->indices.size() * sizeof(uint32_t), mesh->indices.data());
+			glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, mesh->indices.size() * sizeof(uint32_t), mesh->lodIndices.size() * sizeof(uint32_t), mesh->lodIndices.data());
+		}
+		else
+		{
+			std::vector<uint16_t> narrow(mesh->indices.begin(), mesh->indices.end());
+			narrow.insert(narrow.end(), mesh->lodIndices.begin(), mesh->lodIndices.end());
+			glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(uint16_t), narrow.data(), GL_STATIC_DRAW);
+		}
 	}
 
-	glBindVertexArray(GL_NONE);
+	BindVertexArray(GL_NONE);
 	glBindBuffer(GL_ARRAY_BUFFER, GL_NONE);
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, GL_NONE);
 
@@ -186,109 +623,140 @@ void Upload(Mesh* mesh)
 	mesh->ebo = ebo;
 }
 
-void GenCube(Mesh* mesh, float width, float height, float length)
+// Rewrites an indexed mesh with more than 65536 vertices into ranges of at most 65536 vertices each.
+// Triangles keep their order, vertices shared by two ranges are duplicated, and indices become range-relative.
+void SplitIndices16(Mesh* mesh)
 {
-	float positions[] = {
-		-width / 2, -height / 2, length / 2,
-		width / 2, -height / 2, length / 2,
-		width / 2, height / 2, length / 2,
-		-width / 2, height / 2, length / 2,
-		-width / 2, -height / 2, -length / 2,
-		-width / 2, height / 2, -length / 2,
-		width / 2, height / 2, -length / 2,
-		width / 2, -height / 2, -length / 2,
-		-width / 2, height / 2, -length / 2,
-		-width / 2, height / 2, length / 2,
-		width / 2, height / 2, length / 2,
-		width / 2, height / 2, -length / 2,
-		-width / 2, -height / 2, -length / 2,
-		width / 2, -height / 2, -length / 2,
-		width / 2, -height / 2, length / 2,
-		-width / 2, -height / 2, length / 2,
-		width / 2, -height / 2, -length / 2,
-		width / 2, height / 2, -length / 2,
-		width / 2, height / 2, length / 2,
-		width / 2, -height / 2, length / 2,
-		-width / 2, -height / 2, -length / 2,
-		-width / 2, -height / 2, length / 2,
-		-width / 2, height / 2, length / 2,
-		-width / 2, height / 2, -length / 2
-	};
+	const uint32_t RANGE_VERTICES = 65536;
+	const uint32_t UNUSED = ~0u;
+	mesh->ranges.clear();
+	if (mesh->indices.empty() || mesh->positions.size() <= RANGE_VERTICES)
+		return;
 
-	float tcoords[] = {
-		0.0f, 0.0f,
-		1.0f, 0.0f,
-		1.0f, 1.0f,
-		0.0f, 1.0f,
-		1.0f, 0.0f,
-		1.0f, 1.0f,
-		0.0f, 1.0f,
-		0.0f, 0.0f,
-		0.0f, 1.0f,
-		0.0f, 0.0f,
-		1.0f, 0.0f,
-		1.0f, 1.0f,
-		1.0f, 1.0f,
-		0.0f, 1.0f,
-		0.0f, 0.0f,
-		1.0f, 0.0f,
-		1.0f, 0.0f,
-		1.0f, 1.0f,
-		0.0f, 1.0f,
-		0.0f, 0.0f,
-		0.0f, 0.0f,
-		1.0f, 0.0f,
-		1.0f, 1.0f,
-		0.0f, 1.0f
-	};
+	// LODs & meshlets index the unsplit vertices, so split meshes always draw whole & at full detail
+	mesh->lods.clear();
+	mesh->lodIndices.clear();
+	mesh->meshlets.clear();
 
-	float normals[] = {
-		0.0f, 0.0f, 1.0f,
-		0.0f, 0.0f, 1.0f,
-		0.0f, 0.0f, 1.0f,
-		0.0f, 0.0f, 1.0f,
-		0.0f, 0.0f,-1.0f,
-		0.0f, 0.0f,-1.0f,
-		0.0f, 0.0f,-1.0f,
-		0.0f, 0.0f,-1.0f,
-		0.0f, 1.0f, 0.0f,
-		0.0f, 1.0f, 0.0f,
-		0.0f, 1.0f, 0.0f,
-		0.0f, 1.0f, 0.0f,
-		0.0f,-1.0f, 0.0f,
-		0.0f,-1.0f, 0.0f,
-		0.0f,-1.0f, 0.0f,
-		0.0f,-1.0f, 0.0f,
-		1.0f, 0.0f, 0.0f,
-		1.0f, 0.0f, 0.0f,
-		1.0f, 0.0f, 0.0f,
-		1.0f, 0.0f, 0.0f,
-		-1.0f, 0.0f, 0.0f,
-		-1.0f, 0.0f, 0.0f,
-		-1.0f, 0.0f, 0.0f,
-		-1.0f, 0.0f, 0.0f
-	};
+	bool hasTcoords = !mesh->tcoords.empty();
+	std::vector<Vector3> positions, normals;
+	std::vector<Vector2> tcoords;
+	std::vector<uint32_t> indices(mesh->indices.size());
+	positions.reserve(mesh->positions.size());
+	normals.reserve(mesh->normals.size());
+	tcoords.reserve(mesh->tcoords.size());
 
-	mesh->positions.resize(24);
-	mesh->normals.resize(24);
-	mesh->tcoords.resize(24);
-	memcpy(mesh->positions.data(), positions, 24 * sizeof(Vector3));
-	memcpy(mesh->normals.data(), normals, 24 * sizeof(Vector3));
-	memcpy(mesh->tcoords.data(), tcoords, 24 * sizeof(Vector2));
-
-	int k = 0;
-	mesh->indices.resize(36);
-	for (int i = 0; i < 36; i += 6)
-	{
-		mesh->indices[i] = 4 * k;
-		mesh->indices[i + 1] = 4 * k + 1;
-		mesh->indices[i + 2] = 4 * k + 2;
-		mesh->indices[i + 3] = 4 * k;
-		mesh->indices[i + 4] = 4 * k + 2;
-		mesh->indices[i + 5] = 4 * k + 3;
-
-		k++;
+	// Global to range-relative vertex, reset through touched whenever a new range starts
+	std::vector<uint32_t> local(mesh->positions.size(), UNUSED);
+	std::vector<uint32_t> touched;
+	touched.reserve(RANGE_VERTICES);
+
+	MeshRange range;
+	for (size_t i = 0; i < mesh->indices.size(); i += 3)
+	{
+		const uint32_t* tri = &mesh->indices[i];
+		uint32_t added = 0;
+		for (int j = 0; j < 3; j++)
+			added += local[tri[j]] == UNUSED ? 1 : 0;
+
+		if (touched.size() + added > RANGE_VERTICES)
+		{
+			range.count = (int)i - range.offset;
+			mesh->ranges.push_back(range);
+			for (uint32_t vertex : touched)
+				local[vertex] = UNUSED;
+			touched.clear();
+			range.offset = (int)i;
+			range.baseVertex = (int)positions.size();
+		}
+
+		for (int j = 0; j < 3; j++)
+		{
+			uint32_t vertex = tri[j];
+			if (local[vertex] == UNUSED)
+			{
+				local[vertex] = (uint32_t)touched.size();
+				touched.push_back(vertex);
+				positions.push_back(mesh->positions[vertex]);
+				normals.push_back(mesh->normals[vertex]);
+				if (hasTcoords)
+					tcoords.push_back(mesh->tcoords[vertex]);
+			}
+			indices[i + j] = local[vertex];
+		}
 	}
+	range.count = (int)mesh->indices.size() - range.offset;
+	mesh->ranges.push_back(range);
+
+	printf("Split %d vertices into %d 16-bit ranges (%d vertices after duplication)\n",
+		(int)mesh->positions.size(), (int)mesh->ranges.size(), (int)positions.size());
+	mesh->positions = std::move(positions);
+	mesh->normals = std::move(normals);
+	mesh->tcoords = std::move(tcoords);
+	mesh->indices = std::move(indices);
+}
+
+// Unit cube, 4 vertices & 2 triangles per face. Tables are constant so they cost nothing at startup.
+static constexpr Vector3 CUBE_POSITIONS[24] = {
+	{ -0.5f, -0.5f, 0.5f }, { 0.5f, -0.5f, 0.5f }, { 0.5f, 0.5f, 0.5f }, { -0.5f, 0.5f, 0.5f },
+	{ -0.5f, -0.5f, -0.5f }, { -0.5f, 0.5f, -0.5f }, { 0.5f, 0.5f, -0.5f }, { 0.5f, -0.5f, -0.5f },
+	{ -0.5f, 0.5f, -0.5f }, { -0.5f, 0.5f, 0.5f }, { 0.5f, 0.5f, 0.5f }, { 0.5f, 0.5f, -0.5f },
+	{ -0.5f, -0.5f, -0.5f }, { 0.5f, -0.5f, -0.5f }, { 0.5f, -0.5f, 0.5f }, { -0.5f, -0.5f, 0.5f },
+	{ 0.5f, -0.5f, -0.5f }, { 0.5f, 0.5f, -0.5f }, { 0.5f, 0.5f, 0.5f }, { 0.5f, -0.5f, 0.5f },
+	{ -0.5f, -0.5f, -0.5f }, { -0.5f, -0.5f, 0.5f }, { -0.5f, 0.5f, 0.5f }, { -0.5f, 0.5f, -0.5f }
+};
+
+static constexpr Vector3 CUBE_NORMALS[24] = {
+	{ 0.0f, 0.0f, 1.0f }, { 0.0f, 0.0f, 1.0f }, { 0.0f, 0.0f, 1.0f }, { 0.0f, 0.0f, 1.0f },
+	{ 0.0f, 0.0f, -1.0f }, { 0.0f, 0.0f, -1.0f }, { 0.0f, 0.0f, -1.0f }, { 0.0f, 0.0f, -1.0f },
+	{ 0.0f, 1.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, 1.0f, 0.0f },
+	{ 0.0f, -1.0f, 0.0f }, { 0.0f, -1.0f, 0.0f }, { 0.0f, -1.0f, 0.0f }, { 0.0f, -1.0f, 0.0f },
+	{ 1.0f, 0.0f, 0.0f }, { 1.0f, 0.0f, 0.0f }, { 1.0f, 0.0f, 0.0f }, { 1.0f, 0.0f, 0.0f },
+	{ -1.0f, 0.0f, 0.0f }, { -1.0f, 0.0f, 0.0f }, { -1.0f, 0.0f, 0.0f }, { -1.0f, 0.0f, 0.0f }
+};
+
+static constexpr Vector2 CUBE_TCOORDS[24] = {
+	{ 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f },
+	{ 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f }, { 0.0f, 0.0f },
+	{ 0.0f, 1.0f }, { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f },
+	{ 1.0f, 1.0f }, { 0.0f, 1.0f }, { 0.0f, 0.0f }, { 1.0f, 0.0f },
+	{ 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f }, { 0.0f, 0.0f },
+	{ 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f }
+};
+
+static constexpr uint16_t CUBE_INDICES[36] = {
+	0, 1, 2, 0, 2, 3,
+	4, 5, 6, 4, 6, 7,
+	8, 9, 10, 8, 10, 11,
+	12, 13, 14, 12, 14, 15,
+	16, 17, 18, 16, 18, 19,
+	20, 21, 22, 20, 22, 23
+};
+
+static constexpr bool CubeWindingMatchesNormals()
+{
+	for (int i = 0; i < 36; i += 3)
+	{
+		Vector3 a = CUBE_POSITIONS[CUBE_INDICES[i]];
+		Vector3 b = CUBE_POSITIONS[CUBE_INDICES[i + 1]];
+		Vector3 c = CUBE_POSITIONS[CUBE_INDICES[i + 2]];
+		if (!Equals(Normalize(Cross(b - a, c - a)), CUBE_NORMALS[CUBE_INDICES[i]]))
+			return false;
+	}
+	return true;
+}
+static_assert(CubeWindingMatchesNormals(), "Cube triangles must wind counter-clockwise around their normals");
+
+void GenCube(Mesh* mesh, float width, float height, float length)
+{
+	Vector3 size = { width, height, length };
+	mesh->positions.resize(24);
+	for (int i = 0; i < 24; i++)
+		mesh->positions[i] = CUBE_POSITIONS[i] * size;
 
+	mesh->normals.assign(CUBE_NORMALS, CUBE_NORMALS + 24);
+	mesh->tcoords.assign(CUBE_TCOORDS, CUBE_TCOORDS + 24);
+	mesh->indices.assign(CUBE_INDICES, CUBE_INDICES + 36);
 	mesh->count = 36;
+	ComputeBounds(mesh);
 }
@@ -10,6 +10,78 @@ enum ShapeType
 	SPHERE
 };
 
+enum IndexFormat
+{
+	INDEX_AUTO,		// 16-bit indices when every vertex fits, 32-bit otherwise
+	INDEX_SPLIT_16	// Always 16-bit, meshes over 65536 vertices are split into ranges drawn with a base vertex
+};
+
+enum VertexLayout
+{
+	LAYOUT_SEPARATE,	// One buffer per attribute (pbo, nbo, tbo)
+	LAYOUT_INTERLEAVED,	// Single buffer of Vertex structs in pbo, nbo & tbo unused
+	LAYOUT_QUANTIZED	// Single buffer of PackedVertex structs in pbo, draw with the *_quantized.vert shaders & Mesh::dequantize
+};
+
+// Interleaved vertex, 32 bytes so two vertices share a 64-byte cache line
+struct Vertex
+{
+	Vector3 position;
+	Vector3 normal;
+	Vector2 tcoord;
+};
+
+// Compressed vertex, 16 bytes instead of 32
+struct PackedVertex
+{
+	uint16_t position[4];	// unorm16 within the mesh bounds (w unused), expanded by Mesh::dequantize
+	int16_t normal[2];		// snorm16 octahedral encoding
+	uint16_t tcoord[2];		// Half floats
+};
+
+// Contiguous run of triangles whose 16-bit indices are relative to baseVertex
+struct MeshRange
+{
+	int offset = 0;		// First index
+	int count = 0;		// Number of indices
+	int baseVertex = 0;	// Added to every index of the range
+};
+
+// Block of a GeometryArena buffer, in vertices or indices
+struct ArenaBlock
+{
+	int offset = 0;
+	int count = 0;
+};
+
+struct GeometryArena;
+
+// Up to 5 levels of detail, each about half the triangles of the previous one
+constexpr int MESH_MAX_LODS = 5;
+
+struct MeshLod
+{
+	int offset = 0;		// First index in the element buffer
+	int count = 0;		// Number of indices
+	float error = 0.0f;	// Estimated object-space distance the surface moved relative to LOD 0
+};
+
+// Meshlets are sized so their vertices & triangles fit the usual mesh shader limits
+constexpr int MESHLET_MAX_VERTICES = 64;
+constexpr int MESHLET_MAX_TRIANGLES = 124;
+
+// Cluster of neighbouring triangles that is culled as a unit
+struct Meshlet
+{
+	int offset = 0;			// First index in the element buffer
+	int count = 0;			// Number of indices
+	Vector3 center = V3_ZERO;	// Bounding sphere
+	float radius = 0.0f;
+	Vector3 coneApex = V3_ZERO;	// Every triangle faces away from cameras where
+	Vector3 coneAxis = V3_ZERO;	// dot(normalize(coneApex - camera), coneAxis) >= coneCutoff
+	float coneCutoff = 2.0f;	// Above 1 when the triangles face too many ways to ever cull
+};
+
 struct Mesh
 {
 	// Number of triangle points in our mesh
@@ -20,19 +92,65 @@ struct Mesh
 	std::vector<Vector3> positions;
 	std::vector<Vector3> normals;
 	std::vector<Vector2> tcoords;
-	std::vector<uint16_t> indices;
+	std::vector<uint32_t> indices;	// Always 32-bit on the CPU, narrowed to 16-bit on upload when possible
+	std::vector<MeshRange> ranges;	// Only used by INDEX_SPLIT_16 meshes with more than 65536 vertices
+	std::vector<uint32_t> lodIndices;	// Indices of LODs 1+, stored after indices in the element buffer
+	std::vector<MeshLod> lods;		// lods[0] is the full mesh. Empty if no LODs were generated.
+	std::vector<Meshlet> meshlets;	// Partition of the full mesh's indices. Empty if none were built.
+
+	// Object-space bounds, computed with the CPU data and kept after it's released
+	Vector3 boundsMin = V3_ZERO;
+	Vector3 boundsMax = V3_ZERO;
+	Vector3 sphereCenter = V3_ZERO;
+	float sphereRadius = 0.0f;
 
 	// GPU data
+	VertexLayout layout = LAYOUT_SEPARATE;	// Set before CreateMesh to choose how Upload stores vertices
 	GLuint vao = GL_NONE;	// Vertex array object
 	GLuint pbo = GL_NONE;	// Position buffer object
 	GLuint nbo = GL_NONE;	// Normals buffer object
 	GLuint tbo = GL_NONE;	// Tcoords buffer object
 	GLuint ebo = GL_NONE;	// Element buffer object (indices)
+	GLenum indexType = GL_UNSIGNED_SHORT;	// GL_UNSIGNED_SHORT or GL_UNSIGNED_INT
+	Matrix dequantize = MatrixIdentity();	// Maps quantized [0, 1] positions back to object space (LAYOUT_QUANTIZED only)
+
+	// Set before CreateMesh to store the mesh in a shared arena instead of the buffers above (layout is the arena's).
+	// Indices stay mesh-relative & 32-bit, and draws add vertexBlock.offset as their base vertex.
+	GeometryArena* arena = nullptr;
+	ArenaBlock vertexBlock;
+	ArenaBlock indexBlock;
 };
 
-void CreateMesh(Mesh* mesh, const char* path);
+void CreateMesh(Mesh* mesh, const char* path, IndexFormat format = INDEX_AUTO);
+
+// The two halves of CreateMesh(path). LoadMesh only fills CPU data & makes no GL calls, so it can run on any thread.
+// Upload creates the GPU buffers from the CPU data and must run on the GL thread.
+void LoadMesh(Mesh* mesh, const char* path, IndexFormat format = INDEX_AUTO);
+void Upload(Mesh* mesh);
+
+// What LoadMesh does on a cache miss: parses, welds & optimizes the obj, builds meshlets & LODs, then writes <path>.mesh.
+// Always re-cooks, so offline tools can refresh caches ahead of time. Returns false if the obj couldn't be read (leaving the mesh untouched) or the cache couldn't be written.
+bool CookMesh(Mesh* mesh, const char* path);
 void CreateMesh(Mesh* mesh, ShapeType shape);
 void DestroyMesh(Mesh* mesh);
 
-void DrawMesh(const Mesh& mesh);
-void DrawMeshInstanced(const Mesh& mesh, int instanceCount);
\ No newline at end of file
+// Fits the box & sphere bounds to the mesh's positions. Call again after editing positions by hand.
+void ComputeBounds(Mesh* mesh);
+
+// Packs the mesh's attributes into Vertex structs (tcoords are zero if the mesh has none)
+void Interleave(const Mesh& mesh, std::vector<Vertex>* vertices, bool parallel = false);
+
+// Packs the mesh's attributes into PackedVertex structs and writes the matrix that undoes the position quantization
+void Quantize(const Mesh& mesh, std::vector<PackedVertex>* vertices, Matrix* dequantize, bool parallel = false);
+
+// Binds vao unless it's already bound. Everything that binds vertex arrays outside ImGui goes through this, so draws can skip redundant binds.
+void BindVertexArray(GLuint vao);
+
+// First index & index count of a LOD in the mesh's element buffer (or its arena block), LOD 0 if the mesh has no LODs.
+void GetLodRange(const Mesh& mesh, int lod, int* first, int* count);
+
+void DrawMesh(const Mesh& mesh, int lod = 0);
+void DrawMeshInstanced(const Mesh& mesh, int instanceCount, int lod = 0);
+
+// Draws the given meshlets (ie the survivors of CullMeshlets) with a single glMultiDrawElements
+void DrawMeshlets(const Mesh& mesh, const int* meshlets, int count);
\ No newline at end of file
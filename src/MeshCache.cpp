@@ -0,0 +1,272 @@
+#include "MeshCache.h"
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+#include <sys/stat.h>
+#include "Mesh.h"
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+// Bump whenever the layout below or the welding/optimization passes change so stale caches are re-cooked
+static const uint32_t MESH_CACHE_MAGIC = 0x4348534D;	// "MSHC"
+static const uint32_t MESH_CACHE_VERSION = 4;
+
+// Followed by positions, normals, tcoords (if any), 32-bit indices, the LOD table, LOD indices and meshlets
+struct MeshCacheHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint64_t sourceSize;
+	int64_t sourceTime;
+	uint64_t sourceHash;
+	uint32_t vertexCount;
+	uint32_t indexCount;
+	uint32_t hasTcoords;
+	uint32_t lodCount;
+	uint32_t lodIndexCount;
+	uint32_t meshletCount;
+	Vector3 boundsMin;
+	Vector3 boundsMax;
+	Vector3 sphereCenter;
+	float sphereRadius;
+};
+
+bool MapFile(MappedFile* file, const char* path)
+{
+	*file = MappedFile();
+#if defined(_WIN32)
+	HANDLE handle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (handle == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(handle, &size) || size.QuadPart == 0)
+	{
+		CloseHandle(handle);
+		return false;
+	}
+
+	HANDLE mapping = CreateFileMappingA(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	const void* data = mapping != nullptr ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+	if (data == nullptr)
+	{
+		if (mapping != nullptr)
+			CloseHandle(mapping);
+		CloseHandle(handle);
+		return false;
+	}
+
+	file->file = handle;
+	file->mapping = mapping;
+	file->size = (size_t)size.QuadPart;
+	file->data = (const uint8_t*)data;
+#else
+	int fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return false;
+
+	struct stat info;
+	if (fstat(fd, &info) != 0 || info.st_size == 0)
+	{
+		close(fd);
+		return false;
+	}
+
+	void* data = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (data == MAP_FAILED)
+	{
+		close(fd);
+		return false;
+	}
+
+	file->fd = fd;
+	file->size = (size_t)info.st_size;
+	file->data = (const uint8_t*)data;
+#endif
+	return true;
+}
+
+void UnmapFile(MappedFile* file)
+{
+	if (file->data == nullptr)
+		return;
+#if defined(_WIN32)
+	UnmapViewOfFile(file->data);
+	CloseHandle(file->mapping);
+	CloseHandle(file->file);
+#else
+	munmap((void*)file->data, file->size);
+	close(file->fd);
+#endif
+	*file = MappedFile();
+}
+
+static bool StatFile(const char* path, uint64_t* size, int64_t* time)
+{
+#if defined(_WIN32)
+	struct _stat64 info;
+	if (_stat64(path, &info) != 0)
+		return false;
+#else
+	struct stat info;
+	if (stat(path, &info) != 0)
+		return false;
+#endif
+	*size = (uint64_t)info.st_size;
+	*time = (int64_t)info.st_mtime;
+	return true;
+}
+
+// 64-bit FNV-1a of the whole file, 0 if it can't be read
+static uint64_t HashFile(const char* path)
+{
+	MappedFile file;
+	if (!MapFile(&file, path))
+		return 0;
+
+	uint64_t hash = 0xcbf29ce484222325ull;
+	for (size_t i = 0; i < file.size; i++)
+	{
+		hash ^= file.data[i];
+		hash *= 0x100000001b3ull;
+	}
+	UnmapFile(&file);
+	return hash;
+}
+
+static size_t CacheSize(const MeshCacheHeader& header)
+{
+	return sizeof(MeshCacheHeader) + header.vertexCount * (2 * sizeof(Vector3) + (header.hasTcoords ? sizeof(Vector2) : 0)) +
+		(header.indexCount + header.lodIndexCount) * sizeof(uint32_t) + header.lodCount * sizeof(MeshLod) + header.meshletCount * sizeof(Meshlet);
+}
+
+static std::string CachePath(const char* path)
+{
+	return std::string(path) + ".mesh";
+}
+
+bool LoadMeshCache(Mesh* mesh, const char* path)
+{
+	uint64_t sourceSize;
+	int64_t sourceTime;
+	if (!StatFile(path, &sourceSize, &sourceTime))
+		return false;
+
+	MappedFile cache;
+	if (!MapFile(&cache, CachePath(path).c_str()))
+		return false;
+
+	const MeshCacheHeader* header = (const MeshCacheHeader*)cache.data;
+	bool valid = cache.size >= sizeof(MeshCacheHeader) &&
+		header->magic == MESH_CACHE_MAGIC && header->version == MESH_CACHE_VERSION &&
+		cache.size == CacheSize(*header);
+
+	// Size & mtime are the fast path. A different mtime alone (ie a fresh checkout) falls back to comparing the hash,
+	// and on a match the new mtime is written back so later loads take the fast path again.
+	bool touched = false;
+	if (valid && (header->sourceSize != sourceSize || header->sourceTime != sourceTime))
+	{
+		valid = header->sourceSize == sourceSize && header->sourceHash == HashFile(path);
+		touched = valid;
+	}
+
+	if (valid)
+	{
+		// Copied out of the mapping rather than uploaded from it: Upload, arenas, SplitIndices16 & BVH builds all read the
+		// mesh's CPU arrays, and the mesh outlives the mapping
+		uint32_t vertexCount = header->vertexCount;
+		uint32_t indexCount = header->indexCount;
+		const Vector3* positions = (const Vector3*)(header + 1);
+		const Vector3* normals = positions + vertexCount;
+		const Vector2* tcoords = (const Vector2*)(normals + vertexCount);
+		const uint32_t* indices = (const uint32_t*)(tcoords + (header->hasTcoords ? vertexCount : 0));
+		const MeshLod* lods = (const MeshLod*)(indices + indexCount);
+		const uint32_t* lodIndices = (const uint32_t*)(lods + header->lodCount);
+		const Meshlet* meshlets = (const Meshlet*)(lodIndices + header->lodIndexCount);
+
+		mesh->positions.assign(positions, positions + vertexCount);
+		mesh->normals.assign(normals, normals + vertexCount);
+		mesh->tcoords.assign(tcoords, tcoords + (header->hasTcoords ? vertexCount : 0));
+		mesh->indices.assign(indices, indices + indexCount);
+		mesh->lods.assign(lods, lods + header->lodCount);
+		mesh->lodIndices.assign(lodIndices, lodIndices + header->lodIndexCount);
+		mesh->meshlets.assign(meshlets, meshlets + header->meshletCount);
+		mesh->count = (int)indexCount;
+		mesh->boundsMin = header->boundsMin;
+		mesh->boundsMax = header->boundsMax;
+		mesh->sphereCenter = header->sphereCenter;
+		mesh->sphereRadius = header->sphereRadius;
+		printf("Mesh %s: loaded %d vertices & %d indices from cache\n", path, (int)vertexCount, (int)indexCount);
+	}
+
+	UnmapFile(&cache);
+	if (touched)
+	{
+		FILE* file = fopen(CachePath(path).c_str(), "r+b");
+		if (file != nullptr)
+		{
+			if (fseek(file, offsetof(MeshCacheHeader, sourceTime), SEEK_SET) == 0)
+				fwrite(&sourceTime, sizeof(sourceTime), 1, file);
+			fclose(file);
+		}
+	}
+	return valid;
+}
+
+bool SaveMeshCache(const Mesh& mesh, const char* path)
+{
+	MeshCacheHeader header = {};
+	if (!StatFile(path, &header.sourceSize, &header.sourceTime))
+		return false;
+
+	header.magic = MESH_CACHE_MAGIC;
+	header.version = MESH_CACHE_VERSION;
+	header.sourceHash = HashFile(path);
+	header.vertexCount = (uint32_t)mesh.positions.size();
+	header.indexCount = (uint32_t)mesh.indices.size();
+	header.hasTcoords = mesh.tcoords.empty() ? 0 : 1;
+	header.lodCount = (uint32_t)mesh.lods.size();
+	header.lodIndexCount = (uint32_t)mesh.lodIndices.size();
+	header.meshletCount = (uint32_t)mesh.meshlets.size();
+	header.boundsMin = mesh.boundsMin;
+	header.boundsMax = mesh.boundsMax;
+	header.sphereCenter = mesh.sphereCenter;
+	header.sphereRadius = mesh.sphereRadius;
+
+	// Write to a temporary file first so a crash never leaves a truncated cache behind
+	std::string cachePath = CachePath(path);
+	std::string tempPath = cachePath + ".tmp";
+	FILE* file = fopen(tempPath.c_str(), "wb");
+	if (file == nullptr)
+	{
+		printf("**Warning: could not write mesh cache %s**\n", cachePath.c_str());
+		return false;
+	}
+
+	bool written = fwrite(&header, sizeof(header), 1, file) == 1;
+	written = written && fwrite(mesh.positions.data(), sizeof(Vector3), mesh.positions.size(), file) == mesh.positions.size();
+	written = written && fwrite(mesh.normals.data(), sizeof(Vector3), mesh.normals.size(), file) == mesh.normals.size();
+	written = written && fwrite(mesh.tcoords.data(), sizeof(Vector2), mesh.tcoords.size(), file) == mesh.tcoords.size();
+	written = written && fwrite(mesh.indices.data(), sizeof(uint32_t), mesh.indices.size(), file) == mesh.indices.size();
+	written = written && fwrite(mesh.lods.data(), sizeof(MeshLod), mesh.lods.size(), file) == mesh.lods.size();
+	written = written && fwrite(mesh.lodIndices.data(), sizeof(uint32_t), mesh.lodIndices.size(), file) == mesh.lodIndices.size();
+	written = written && fwrite(mesh.meshlets.data(), sizeof(Meshlet), mesh.meshlets.size(), file) == mesh.meshlets.size();
+	written = fclose(file) == 0 && written;
+
+	remove(cachePath.c_str());
+	if (!written || rename(tempPath.c_str(), cachePath.c_str()) != 0)
+	{
+		remove(tempPath.c_str());
+		printf("**Warning: could not write mesh cache %s**\n", cachePath.c_str());
+		return false;
+	}
+	return true;
+}
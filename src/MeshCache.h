@@ -0,0 +1,27 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+struct Mesh;
+
+// Read-only memory mapping of a whole file
+struct MappedFile
+{
+	const uint8_t* data = nullptr;
+	size_t size = 0;
+#if defined(_WIN32)
+	void* file = nullptr;		// HANDLE
+	void* mapping = nullptr;	// HANDLE
+#else
+	int fd = -1;
+#endif
+};
+
+bool MapFile(MappedFile* file, const char* path);
+void UnmapFile(MappedFile* file);
+
+// Cooked meshes are stored next to their source as <path>.mesh and hold welded, optimized vertices & indices plus bounds.
+// Load fails (and the caller should re-cook) if the cache is missing, from an older format version, or its source changed.
+// Save stores the mesh's current bounds, so call ComputeBounds first.
+bool LoadMeshCache(Mesh* mesh, const char* path);
+bool SaveMeshCache(const Mesh& mesh, const char* path);
@@ -0,0 +1,288 @@
+#include "MeshOptimizer.h"
+#include "Mesh.h"
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+
+// Cache entries are timestamps: a vertex is resident while fewer than cacheSize misses happened since it was loaded.
+// Advancing time by cacheSize + 1 flushes the whole cache.
+static int CountMisses(const uint32_t* indices, int begin, int end, int cacheSize, std::vector<int>* stamps, int* time)
+{
+	int misses = 0;
+	for (int i = begin; i < end; i++)
+	{
+		int& stamp = (*stamps)[indices[i]];
+		if (*time - stamp > cacheSize)
+		{
+			stamp = (*time)++;
+			misses++;
+		}
+	}
+	return misses;
+}
+
+VertexCacheStats AnalyzeVertexCache(const uint32_t* indices, int count, int vertexCount, int cacheSize)
+{
+	VertexCacheStats stats;
+	if (count < 3)
+		return stats;
+
+	std::vector<int> stamps(vertexCount, 0);
+	int time = cacheSize + 1;
+	int misses = CountMisses(indices, 0, count, cacheSize, &stamps, &time);
+
+	int referenced = 0;
+	for (int stamp : stamps)
+		referenced += stamp != 0 ? 1 : 0;
+
+	stats.acmr = (float)misses / (float)(count / 3);
+	stats.atvr = (float)misses / (float)referenced;
+	return stats;
+}
+
+void OptimizeVertexCache(uint32_t* indices, int count, int vertexCount, std::vector<int>* clusters, int cacheSize)
+{
+	int triangleCount = count / 3;
+	if (clusters != nullptr)
+		clusters->clear();
+	if (triangleCount == 0)
+		return;
+
+	// Vertex -> triangle adjacency, stored as one array with per-vertex offsets
+	std::vector<int> offsets(vertexCount + 1, 0);
+	for (int i = 0; i < count; i++)
+		offsets[indices[i] + 1]++;
+	for (int v = 0; v < vertexCount; v++)
+		offsets[v + 1] += offsets[v];
+
+	std::vector<int> adjacency(count);
+	std::vector<int> fill(offsets.begin(), offsets.end() - 1);
+	for (int i = 0; i < count; i++)
+		adjacency[fill[indices[i]]++] = i / 3;
+
+	// Number of triangles still to be emitted per vertex
+	std::vector<int> live(vertexCount);
+	for (int v = 0; v < vertexCount; v++)
+		live[v] = offsets[v + 1] - offsets[v];
+
+	std::vector<int> stamps(vertexCount, 0);
+	std::vector<bool> emitted(triangleCount, false);
+	std::vector<uint32_t> deadEnds;
+	std::vector<uint32_t> candidates;
+	std::vector<uint32_t> result;
+	deadEnds.reserve(count);
+	result.reserve(count);
+	int time = cacheSize + 1;
+	int cursor = 0;
+
+	auto nextDeadEnd = [&]()
+	{
+		// Recently used vertices first, then the lowest unfinished vertex
+		while (!deadEnds.empty())
+		{
+			uint32_t vertex = deadEnds.back();
+			deadEnds.pop_back();
+			if (live[vertex] > 0)
+				return (int)vertex;
+		}
+
+		while (cursor < vertexCount)
+		{
+			if (live[cursor] > 0)
+				return cursor;
+			cursor++;
+		}
+		return -1;
+	};
+
+	int fan = nextDeadEnd();
+	if (clusters != nullptr)
+		clusters->push_back(0);
+	while (fan >= 0)
+	{
+		// Emit every remaining triangle around the fanning vertex
+		candidates.clear();
+		for (int a = offsets[fan]; a < offsets[fan + 1]; a++)
+		{
+			int triangle = adjacency[a];
+			if (emitted[triangle])
+				continue;
+
+			for (int j = 0; j < 3; j++)
+			{
+				uint32_t vertex = indices[triangle * 3 + j];
+				result.push_back(vertex);
+				deadEnds.push_back(vertex);
+				candidates.push_back(vertex);
+				live[vertex]--;
+				if (time - stamps[vertex] > cacheSize)
+					stamps[vertex] = time++;
+			}
+			emitted[triangle] = true;
+		}
+
+		// Prefer the oldest candidate that stays in cache while its own fan is emitted
+		int next = -1;
+		int best = -1;
+		for (uint32_t vertex : candidates)
+		{
+			if (live[vertex] == 0)
+				continue;
+
+			int priority = 0;
+			if (time - stamps[vertex] + 2 * live[vertex] <= cacheSize)
+				priority = time - stamps[vertex];
+			if (priority > best)
+			{
+				best = priority;
+				next = (int)vertex;
+			}
+		}
+
+		if (next < 0)
+		{
+			next = nextDeadEnd();
+			// A dead end ends the current cluster
+			if (clusters != nullptr && next >= 0)
+				clusters->push_back((int)result.size());
+		}
+		fan = next;
+	}
+
+	assert((int)result.size() == count);
+	memcpy(indices, result.data(), count * sizeof(uint32_t));
+}
+
+void OptimizeOverdraw(uint32_t* indices, int count, const Vector3* positions, int vertexCount,
+	const std::vector<int>& clusters, int cacheSize, float threshold)
+{
+	if (count < 3)
+		return;
+
+	// 1. Split each cluster wherever the ACMR of the piece so far is within threshold of the whole cluster's
+	std::vector<int> starts;
+	std::vector<int> stamps(vertexCount, 0);
+	int time = cacheSize + 1;
+	for (size_t c = 0; c < clusters.size(); c++)
+	{
+		int begin = clusters[c];
+		int end = c + 1 < clusters.size() ? clusters[c + 1] : count;
+
+		time += cacheSize + 1;
+		float target = threshold * (float)CountMisses(indices, begin, end, cacheSize, &stamps, &time) / (float)((end - begin) / 3);
+
+		int start = begin;
+		int misses = 0;
+		time += cacheSize + 1;
+		for (int i = begin; i < end; i += 3)
+		{
+			misses += CountMisses(indices, i, i + 3, cacheSize, &stamps, &time);
+			if (i + 3 < end && (float)misses <= target * (float)((i + 3 - start) / 3))
+			{
+				starts.push_back(start);
+				start = i + 3;
+				misses = 0;
+				time += cacheSize + 1;
+			}
+		}
+		starts.push_back(start);
+	}
+
+	// 2. Area-weighted centroid and normal of each cluster, and of the whole mesh
+	int clusterCount = (int)starts.size();
+	std::vector<Vector3> centroids(clusterCount, Vector3{ 0.0f, 0.0f, 0.0f });
+	std::vector<Vector3> normals(clusterCount, Vector3{ 0.0f, 0.0f, 0.0f });
+	Vector3 meshCentroid = { 0.0f, 0.0f, 0.0f };
+	float meshArea = 0.0f;
+	for (int c = 0; c < clusterCount; c++)
+	{
+		int end = c + 1 < clusterCount ? starts[c + 1] : count;
+		float area = 0.0f;
+		for (int i = starts[c]; i < end; i += 3)
+		{
+			Vector3 a = positions[indices[i + 0]];
+			Vector3 b = positions[indices[i + 1]];
+			Vector3 p = positions[indices[i + 2]];
+			Vector3 normal = Cross(b - a, p - a);
+			float weight = Length(normal);
+			centroids[c] += (a + b + p) * (weight / 3.0f);
+			normals[c] += normal;
+			area += weight;
+		}
+
+		meshCentroid += centroids[c];
+		meshArea += area;
+		centroids[c] = area > 0.0f ? centroids[c] / area : positions[indices[starts[c]]];
+	}
+	meshCentroid = meshArea > 0.0f ? meshCentroid / meshArea : meshCentroid;
+
+	// 3. Clusters that face away from the mesh centre are most likely to occlude others, so draw them first
+	std::vector<float> keys(clusterCount);
+	std::vector<int> order(clusterCount);
+	for (int c = 0; c < clusterCount; c++)
+	{
+		keys[c] = Dot(centroids[c] - meshCentroid, Normalize(normals[c]));
+		order[c] = c;
+	}
+	std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return keys[a] > keys[b]; });
+
+	std::vector<uint32_t> result;
+	result.reserve(count);
+	for (int c : order)
+	{
+		int end = c + 1 < clusterCount ? starts[c + 1] : count;
+		result.insert(result.end(), indices + starts[c], indices + end);
+	}
+	memcpy(indices, result.data(), count * sizeof(uint32_t));
+}
+
+void OptimizeVertexFetch(Mesh* mesh)
+{
+	const uint32_t UNUSED = ~0u;
+	int vertexCount = (int)mesh->positions.size();
+	bool hasTcoords = !mesh->tcoords.empty();
+	std::vector<uint32_t> remap(vertexCount, UNUSED);
+	std::vector<Vector3> positions, normals;
+	std::vector<Vector2> tcoords;
+	positions.reserve(vertexCount);
+	normals.reserve(vertexCount);
+	tcoords.reserve(mesh->tcoords.size());
+
+	for (uint32_t& index : mesh->indices)
+	{
+		if (remap[index] == UNUSED)
+		{
+			remap[index] = (uint32_t)positions.size();
+			positions.push_back(mesh->positions[index]);
+			normals.push_back(mesh->normals[index]);
+			if (hasTcoords)
+				tcoords.push_back(mesh->tcoords[index]);
+		}
+		index = remap[index];
+	}
+
+	mesh->positions = std::move(positions);
+	mesh->normals = std::move(normals);
+	mesh->tcoords = std::move(tcoords);
+}
+
+void OptimizeMesh(Mesh* mesh, const char* name)
+{
+	assert(mesh->ranges.empty(), "Optimize before splitting into 16-bit ranges");
+	if (mesh->indices.empty())
+		return;
+
+	uint32_t* indices = mesh->indices.data();
+	int count = (int)mesh->indices.size();
+	int vertexCount = (int)mesh->positions.size();
+	VertexCacheStats before = AnalyzeVertexCache(indices, count, vertexCount);
+
+	std::vector<int> clusters;
+	OptimizeVertexCache(indices, count, vertexCount, &clusters);
+	OptimizeOverdraw(indices, count, mesh->positions.data(), vertexCount, clusters);
+	OptimizeVertexFetch(mesh);
+
+	VertexCacheStats after = AnalyzeVertexCache(mesh->indices.data(), count, (int)mesh->positions.size());
+	printf("Mesh %s: ACMR %.3f -> %.3f, ATVR %.3f -> %.3f\n", name, before.acmr, after.acmr, before.atvr, after.atvr);
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "Math.h"
+
+struct Mesh;
+
+// Post-transform vertex cache statistics, simulated with a FIFO cache
+struct VertexCacheStats
+{
+	float acmr = 0.0f;	// Average cache misses per triangle (0.5 is ideal for large meshes, 3 is worst case)
+	float atvr = 0.0f;	// Average transformed vertices per referenced vertex (1 is ideal)
+};
+
+VertexCacheStats AnalyzeVertexCache(const uint32_t* indices, int count, int vertexCount, int cacheSize = 16);
+
+// Tipsify (Sander et al. 2007) triangle reordering for the post-transform cache.
+// Optionally writes the first index of every cluster, split wherever the walk hit a dead end.
+void OptimizeVertexCache(uint32_t* indices, int count, int vertexCount, std::vector<int>* clusters = nullptr, int cacheSize = 16);
+
+// Splits clusters further while their ACMR stays within threshold of the original,
+// then sorts them so outward-facing clusters are drawn first and occlude the rest for early-z.
+void OptimizeOverdraw(uint32_t* indices, int count, const Vector3* positions, int vertexCount,
+	const std::vector<int>& clusters, int cacheSize = 16, float threshold = 1.05f);
+
+// Reorders vertices by first use so vertex fetch walks memory forwards. Unreferenced vertices are removed.
+void OptimizeVertexFetch(Mesh* mesh);
+
+// Runs all three passes on an indexed mesh and prints ACMR/ATVR before and after
+void OptimizeMesh(Mesh* mesh, const char* name);
@@ -0,0 +1,413 @@
+#include "MeshSimplifier.h"
+#include "Mesh.h"
+#include "MeshOptimizer.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <numeric>
+
+// Border planes are weighted above surface planes so open edges keep their shape
+static const double BORDER_WEIGHT = 10.0;
+
+// LODs stop once a level would have fewer triangles than this, or simplification stalls
+static const int MIN_LOD_TRIANGLES = 32;
+
+// Symmetric 4x4 quadric as its upper triangle, plus the total weight used to turn it into a squared distance
+struct Quadric
+{
+	double a2 = 0.0, ab = 0.0, ac = 0.0, ad = 0.0;
+	double b2 = 0.0, bc = 0.0, bd = 0.0;
+	double c2 = 0.0, cd = 0.0;
+	double d2 = 0.0;
+	double weight = 0.0;
+};
+
+enum VertexKind : uint8_t
+{
+	KIND_MANIFOLD,	// Collapses onto any neighbour
+	KIND_SEAM,		// Shares its position with other vertices (uv or normal seam), collapses along seams only
+	KIND_BORDER		// On an edge with one triangle (or more than two), collapses along borders only
+};
+
+struct Collapse
+{
+	uint32_t from;
+	uint32_t to;
+	double error;	// Squared distance
+};
+
+static void AddPlane(Quadric* q, double a, double b, double c, double d, double w)
+{
+	q->a2 += w * a * a; q->ab += w * a * b; q->ac += w * a * c; q->ad += w * a * d;
+	q->b2 += w * b * b; q->bc += w * b * c; q->bd += w * b * d;
+	q->c2 += w * c * c; q->cd += w * c * d;
+	q->d2 += w * d * d;
+	q->weight += w;
+}
+
+static void AddQuadric(Quadric* q, const Quadric& r)
+{
+	q->a2 += r.a2; q->ab += r.ab; q->ac += r.ac; q->ad += r.ad;
+	q->b2 += r.b2; q->bc += r.bc; q->bd += r.bd;
+	q->c2 += r.c2; q->cd += r.cd;
+	q->d2 += r.d2;
+	q->weight += r.weight;
+}
+
+// Weighted sum of squared distances from p to the quadric's planes
+static double Evaluate(const Quadric& q, Vector3 p)
+{
+	double x = p.x, y = p.y, z = p.z;
+	double error =
+		q.a2 * x * x + 2.0 * q.ab * x * y + 2.0 * q.ac * x * z + 2.0 * q.ad * x +
+		q.b2 * y * y + 2.0 * q.bc * y * z + 2.0 * q.bd * y +
+		q.c2 * z * z + 2.0 * q.cd * z +
+		q.d2;
+	return error > 0.0 ? error : 0.0;
+}
+
+static inline uint64_t EdgeKey(uint32_t a, uint32_t b)
+{
+	return a < b ? ((uint64_t)a << 32) | b : ((uint64_t)b << 32) | a;
+}
+
+float SimplifyMesh(const uint32_t* indices, int count, const Vector3* positions, const Vector3* normals, const Vector2* tcoords,
+	int vertexCount, int targetCount, float maxError, std::vector<uint32_t>* out)
+{
+	std::vector<uint32_t>& triangles = *out;
+	triangles.assign(indices, indices + count);
+	if (count <= targetCount)
+		return 0.0f;
+
+	// 1. Group vertices sharing a position. Collapses move whole groups so seams never tear.
+	std::vector<uint32_t> members(vertexCount);
+	std::iota(members.begin(), members.end(), 0u);
+	std::sort(members.begin(), members.end(), [positions](uint32_t a, uint32_t b)
+	{
+		return memcmp(&positions[a], &positions[b], sizeof(Vector3)) < 0;
+	});
+
+	std::vector<uint32_t> group(vertexCount);
+	std::vector<int> groupOffsets;
+	for (int i = 0; i < vertexCount; i++)
+	{
+		if (i == 0 || memcmp(&positions[members[i]], &positions[members[i - 1]], sizeof(Vector3)) != 0)
+			groupOffsets.push_back(i);
+		group[members[i]] = (uint32_t)groupOffsets.size() - 1;
+	}
+	int groupCount = (int)groupOffsets.size();
+	groupOffsets.push_back(vertexCount);
+
+	// 2. Classify groups. Only referenced vertices count towards seams.
+	std::vector<uint8_t> referenced(vertexCount, 0);
+	for (int i = 0; i < count; i++)
+		referenced[indices[i]] = 1;
+
+	std::vector<uint8_t> kinds(groupCount, KIND_MANIFOLD);
+	for (int g = 0; g < groupCount; g++)
+	{
+		int used = 0;
+		for (int m = groupOffsets[g]; m < groupOffsets[g + 1]; m++)
+			used += referenced[members[m]];
+		if (used > 1)
+			kinds[g] = KIND_SEAM;
+	}
+
+	std::vector<uint64_t> edges;
+	edges.reserve(count);
+	for (int i = 0; i < count; i += 3)
+	{
+		for (int e = 0; e < 3; e++)
+		{
+			uint32_t a = group[indices[i + e]];
+			uint32_t b = group[indices[i + (e + 1) % 3]];
+			if (a != b)
+				edges.push_back(EdgeKey(a, b));
+		}
+	}
+	std::sort(edges.begin(), edges.end());
+
+	std::vector<uint64_t> borders;
+	for (size_t i = 0; i < edges.size();)
+	{
+		size_t j = i;
+		while (j < edges.size() && edges[j] == edges[i])
+			j++;
+		if (j - i != 2)
+		{
+			borders.push_back(edges[i]);
+			kinds[edges[i] >> 32] = KIND_BORDER;
+			kinds[edges[i] & 0xFFFFFFFF] = KIND_BORDER;
+		}
+		i = j;
+	}
+
+	// 3. Area-weighted plane quadrics per group, plus planes perpendicular to border edges
+	std::vector<Quadric> quadrics(groupCount);
+	for (int i = 0; i < count; i += 3)
+	{
+		uint32_t g[3] = { group[indices[i]], group[indices[i + 1]], group[indices[i + 2]] };
+		Vector3 p0 = positions[indices[i]], p1 = positions[indices[i + 1]], p2 = positions[indices[i + 2]];
+		Vector3 normal = Cross(p1 - p0, p2 - p0);
+		float length = Length(normal);
+		if (length <= 0.0f)
+			continue;
+
+		normal = normal / length;
+		for (int k = 0; k < 3; k++)
+			AddPlane(&quadrics[g[k]], normal.x, normal.y, normal.z, -Dot(normal, p0), 0.5 * length);
+
+		for (int e = 0; e < 3; e++)
+		{
+			uint32_t a = g[e], b = g[(e + 1) % 3];
+			if (a == b || !std::binary_search(borders.begin(), borders.end(), EdgeKey(a, b)))
+				continue;
+
+			Vector3 pa = positions[indices[i + e]];
+			Vector3 pb = positions[indices[i + (e + 1) % 3]];
+			Vector3 edge = pb - pa;
+			Vector3 side = Normalize(Cross(edge, normal));
+			double weight = BORDER_WEIGHT * Dot(edge, edge);
+			AddPlane(&quadrics[a], side.x, side.y, side.z, -Dot(side, pa), weight);
+			AddPlane(&quadrics[b], side.x, side.y, side.z, -Dot(side, pa), weight);
+		}
+	}
+
+	auto groupPosition = [&](uint32_t g) { return positions[members[groupOffsets[g]]]; };
+	auto collapseError = [&](uint32_t from, uint32_t to)
+	{
+		Quadric q = quadrics[from];
+		AddQuadric(&q, quadrics[to]);
+		return q.weight > 0.0 ? Evaluate(q, groupPosition(to)) / q.weight : 0.0;
+	};
+
+	// Vertex of group g whose attributes best match v, so seams keep their sides after a collapse
+	auto closestVertex = [&](uint32_t v, uint32_t g)
+	{
+		uint32_t best = members[groupOffsets[g]];
+		double bestScore = std::numeric_limits<double>::max();
+		for (int m = groupOffsets[g]; m < groupOffsets[g + 1]; m++)
+		{
+			uint32_t w = members[m];
+			if (!referenced[w])
+				continue;
+
+			double score = 0.0;
+			if (normals != nullptr)
+				score += 1.0 - Dot(normals[v], normals[w]);
+			if (tcoords != nullptr)
+				score += LengthSqr(tcoords[v] - tcoords[w]);
+			if (score < bestScore)
+			{
+				bestScore = score;
+				best = w;
+			}
+		}
+		return best;
+	};
+
+	// 4. Passes of independent collapses, cheapest first, until the target or error limit is reached
+	double maxErrorSq = (double)maxError * (double)maxError;
+	double error = 0.0;
+	std::vector<int> adjacencyOffsets(groupCount + 1);
+	std::vector<int> adjacency;
+	std::vector<uint8_t> locked(groupCount);
+	std::vector<uint32_t> collapseTo(groupCount);
+	std::vector<Collapse> candidates;
+	while ((int)triangles.size() > targetCount)
+	{
+		int triangleCount = (int)triangles.size() / 3;
+
+		// Group -> triangle adjacency
+		std::fill(adjacencyOffsets.begin(), adjacencyOffsets.end(), 0);
+		for (uint32_t v : triangles)
+			adjacencyOffsets[group[v] + 1]++;
+		for (int g = 0; g < groupCount; g++)
+			adjacencyOffsets[g + 1] += adjacencyOffsets[g];
+		adjacency.resize(triangles.size());
+		std::vector<int> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+		for (int i = 0; i < (int)triangles.size(); i++)
+			adjacency[fill[group[triangles[i]]]++] = i / 3;
+
+		// Cheapest allowed direction of every edge
+		edges.clear();
+		for (int i = 0; i < (int)triangles.size(); i += 3)
+		{
+			for (int e = 0; e < 3; e++)
+			{
+				uint32_t a = group[triangles[i + e]];
+				uint32_t b = group[triangles[i + (e + 1) % 3]];
+				if (a != b)
+					edges.push_back(EdgeKey(a, b));
+			}
+		}
+		std::sort(edges.begin(), edges.end());
+		edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+		candidates.clear();
+		for (uint64_t edge : edges)
+		{
+			uint32_t a = (uint32_t)(edge >> 32), b = (uint32_t)(edge & 0xFFFFFFFF);
+			bool ab = kinds[a] == KIND_MANIFOLD || kinds[a] == kinds[b];
+			bool ba = kinds[b] == KIND_MANIFOLD || kinds[b] == kinds[a];
+			double errorAB = ab ? collapseError(a, b) : std::numeric_limits<double>::max();
+			double errorBA = ba ? collapseError(b, a) : std::numeric_limits<double>::max();
+			if (ab && errorAB <= errorBA)
+				candidates.push_back({ a, b, errorAB });
+			else if (ba)
+				candidates.push_back({ b, a, errorBA });
+		}
+		std::sort(candidates.begin(), candidates.end(), [](const Collapse& a, const Collapse& b) { return a.error < b.error; });
+
+		std::fill(locked.begin(), locked.end(), 0);
+		std::iota(collapseTo.begin(), collapseTo.end(), 0u);
+		int removeCount = triangleCount - targetCount / 3;
+		int removed = 0;
+		for (const Collapse& collapse : candidates)
+		{
+			if (collapse.error > maxErrorSq || removed >= removeCount)
+				break;
+			if (locked[collapse.from] || locked[collapse.to])
+				continue;
+
+			// Triangles around from either die (they contain to) or move, and moving ones must not flip
+			Vector3 target = groupPosition(collapse.to);
+			int dying = 0;
+			bool flips = false;
+			for (int a = adjacencyOffsets[collapse.from]; a < adjacencyOffsets[collapse.from + 1] && !flips; a++)
+			{
+				const uint32_t* tri = &triangles[adjacency[a] * 3];
+				if (group[tri[0]] == collapse.to || group[tri[1]] == collapse.to || group[tri[2]] == collapse.to)
+				{
+					dying++;
+					continue;
+				}
+
+				Vector3 p[3], q[3];
+				for (int k = 0; k < 3; k++)
+				{
+					p[k] = positions[tri[k]];
+					q[k] = group[tri[k]] == collapse.from ? target : p[k];
+				}
+				Vector3 before = Cross(p[1] - p[0], p[2] - p[0]);
+				Vector3 after = Cross(q[1] - q[0], q[2] - q[0]);
+				flips = Dot(before, after) <= 0.0f;
+			}
+			if (flips)
+				continue;
+
+			// Lock the one-ring so every collapse in this pass sees up-to-date neighbours
+			for (int a = adjacencyOffsets[collapse.from]; a < adjacencyOffsets[collapse.from + 1]; a++)
+			{
+				const uint32_t* tri = &triangles[adjacency[a] * 3];
+				locked[group[tri[0]]] = locked[group[tri[1]]] = locked[group[tri[2]]] = 1;
+			}
+			collapseTo[collapse.from] = collapse.to;
+			AddQuadric(&quadrics[collapse.to], quadrics[collapse.from]);
+			error = std::max(error, collapse.error);
+			removed += dying;
+		}
+
+		if (removed == 0)
+			break;
+
+		// Apply the pass, dropping triangles that became degenerate
+		size_t write = 0;
+		for (size_t i = 0; i < triangles.size(); i += 3)
+		{
+			uint32_t tri[3];
+			for (int k = 0; k < 3; k++)
+			{
+				uint32_t v = triangles[i + k];
+				uint32_t g = group[v];
+				tri[k] = collapseTo[g] == g ? v : closestVertex(v, collapseTo[g]);
+			}
+
+			if (group[tri[0]] == group[tri[1]] || group[tri[1]] == group[tri[2]] || group[tri[2]] == group[tri[0]])
+				continue;
+			triangles[write++] = tri[0];
+			triangles[write++] = tri[1];
+			triangles[write++] = tri[2];
+		}
+		triangles.resize(write);
+	}
+
+	return (float)std::sqrt(error);
+}
+
+void GenerateLods(Mesh* mesh, const char* name)
+{
+	mesh->lods.clear();
+	mesh->lodIndices.clear();
+	if (mesh->indices.empty() || !mesh->ranges.empty())
+		return;
+
+	int vertexCount = (int)mesh->positions.size();
+	Vector3 min = mesh->positions[0], max = mesh->positions[0];
+	for (Vector3 p : mesh->positions)
+	{
+		min = { Min(min.x, p.x), Min(min.y, p.y), Min(min.z, p.z) };
+		max = { Max(max.x, p.x), Max(max.y, p.y), Max(max.z, p.z) };
+	}
+	float radius = Length(max - min) * 0.5f;
+
+	MeshLod full;
+	full.count = (int)mesh->indices.size();
+	mesh->lods.push_back(full);
+
+	std::vector<uint32_t> current = mesh->indices;
+	std::vector<uint32_t> simplified;
+	float error = 0.0f;
+	while ((int)mesh->lods.size() < MESH_MAX_LODS)
+	{
+		int target = (int)current.size() / 6 * 3;
+		if (target < MIN_LOD_TRIANGLES * 3)
+			break;
+
+		auto start = std::chrono::steady_clock::now();
+		float levelError = SimplifyMesh(current.data(), (int)current.size(), mesh->positions.data(), mesh->normals.data(),
+			mesh->tcoords.empty() ? nullptr : mesh->tcoords.data(), vertexCount, target, std::numeric_limits<float>::max(), &simplified);
+
+		// Borders & seams can lock most of a mesh, at which point further levels aren't worth their memory
+		if (simplified.size() * 4 > current.size() * 3)
+			break;
+
+		OptimizeVertexCache(simplified.data(), (int)simplified.size(), vertexCount);
+		double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		// Each level is simplified from the previous one, so errors add up
+		error += levelError;
+		MeshLod lod;
+		lod.offset = (int)(mesh->indices.size() + mesh->lodIndices.size());
+		lod.count = (int)simplified.size();
+		lod.error = error;
+		mesh->lodIndices.insert(mesh->lodIndices.end(), simplified.begin(), simplified.end());
+		mesh->lods.push_back(lod);
+
+		printf("Mesh %s: LOD %d has %d triangles (%.0f%%), error %.4g (%.2f%% of radius), %.1f ms\n",
+			name, (int)mesh->lods.size() - 1, lod.count / 3, 100.0f * lod.count / mesh->count, error, 100.0f * error / radius, ms);
+		current.swap(simplified);
+	}
+
+	if (mesh->lods.size() == 1)
+		mesh->lods.clear();
+}
+
+float ProjectionScale(float fovY, float screenHeight)
+{
+	return screenHeight / (2.0f * tanf(fovY * 0.5f));
+}
+
+int SelectLod(const Mesh& mesh, float distance, float projectionScale, float pixelError)
+{
+	// Errors grow with each level, so the last level within budget is the coarsest acceptable one
+	int lod = 0;
+	for (int i = 1; i < (int)mesh.lods.size(); i++)
+	{
+		if (mesh.lods[i].error * projectionScale <= pixelError * distance)
+			lod = i;
+	}
+	return lod;
+}
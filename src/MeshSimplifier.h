@@ -0,0 +1,22 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "Math.h"
+
+struct Mesh;
+
+// Quadric error metric (Garland & Heckbert 1997) edge-collapse simplification.
+// Vertices collapse onto neighbouring vertices, so the result indexes the same vertex arrays as the input.
+// Borders only collapse along borders and attribute seams along seams. Collapses that would flip a triangle are skipped.
+// Stops at targetCount indices or once the next collapse would move the surface further than maxError, and returns the error reached.
+float SimplifyMesh(const uint32_t* indices, int count, const Vector3* positions, const Vector3* normals, const Vector2* tcoords,
+	int vertexCount, int targetCount, float maxError, std::vector<uint32_t>* out);
+
+// Builds up to MESH_MAX_LODS levels of halving triangle counts into mesh->lods & mesh->lodIndices, and reports each level
+void GenerateLods(Mesh* mesh, const char* name);
+
+// Pixels per object-space unit at distance 1, for a perspective projection with vertical field of view fovY (radians)
+float ProjectionScale(float fovY, float screenHeight);
+
+// Coarsest LOD whose error, projected at distance, stays within pixelError pixels
+int SelectLod(const Mesh& mesh, float distance, float projectionScale, float pixelError = 1.0f);
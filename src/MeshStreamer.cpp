@@ -0,0 +1,193 @@
+#include "MeshStreamer.h"
+#include <cassert>
+
+static void StreamWorker(MeshStreamer* streamer)
+{
+	for (;;)
+	{
+		StreamedMesh* entry = nullptr;
+		{
+			std::unique_lock<std::mutex> lock(streamer->mutex);
+			streamer->wake.wait(lock, [streamer] { return streamer->quit || !streamer->requests.empty(); });
+			if (streamer->quit)
+				return;
+			entry = streamer->requests.front();
+			streamer->requests.pop_front();
+		}
+
+		// The GL thread doesn't touch queued meshes, so decoding needs no lock
+		LoadMesh(&entry->mesh, entry->path.c_str(), entry->format);
+
+		std::lock_guard<std::mutex> lock(streamer->mutex);
+		entry->state = STREAM_DECODED;
+		streamer->decoded.push_back(entry);
+	}
+}
+
+static void Enqueue(MeshStreamer* streamer, StreamedMesh* entry)
+{
+	{
+		std::lock_guard<std::mutex> lock(streamer->mutex);
+		entry->state = STREAM_QUEUED;
+		streamer->requests.push_back(entry);
+	}
+	streamer->wake.notify_one();
+}
+
+// Size of the buffers Upload will create for the mesh's current CPU data
+static size_t GpuBytes(const Mesh& mesh)
+{
+	size_t stride = 0;
+	switch (mesh.layout)
+	{
+	case LAYOUT_SEPARATE:
+		stride = 2 * sizeof(Vector3) + (mesh.tcoords.empty() ? 0 : sizeof(Vector2));
+		break;
+
+	case LAYOUT_INTERLEAVED:
+		stride = sizeof(Vertex);
+		break;
+
+	case LAYOUT_QUANTIZED:
+		stride = sizeof(PackedVertex);
+		break;
+	}
+
+	bool wide = mesh.ranges.empty() && mesh.positions.size() > 65536;
+	return mesh.positions.size() * stride + (mesh.indices.size() + mesh.lodIndices.size()) * (wide ? sizeof(uint32_t) : sizeof(uint16_t));
+}
+
+// Resident meshes only need their GPU buffers, LOD table & meshlet bounds to draw
+static void ReleaseCpuData(Mesh* mesh)
+{
+	std::vector<Vector3>().swap(mesh->positions);
+	std::vector<Vector3>().swap(mesh->normals);
+	std::vector<Vector2>().swap(mesh->tcoords);
+	std::vector<uint32_t>().swap(mesh->indices);
+	std::vector<uint32_t>().swap(mesh->lodIndices);
+}
+
+// Evicts least-recently-drawn meshes until bytes more fit in the budget, or only recently drawn meshes remain
+static void Evict(MeshStreamer* streamer, size_t bytes)
+{
+	while (streamer->residentBytes + bytes > streamer->residentBudget)
+	{
+		StreamedMesh* oldest = nullptr;
+		for (const std::unique_ptr<StreamedMesh>& entry : streamer->meshes)
+		{
+			bool recent = entry->lastUsed + 1 >= streamer->frame;
+			if (entry->state == STREAM_RESIDENT && !recent && (oldest == nullptr || entry->lastUsed < oldest->lastUsed))
+				oldest = entry.get();
+		}
+
+		if (oldest == nullptr)
+			break;
+
+		DestroyMesh(&oldest->mesh);
+		streamer->residentBytes -= oldest->gpuBytes;
+		oldest->gpuBytes = 0;
+		oldest->state = STREAM_UNLOADED;
+	}
+}
+
+void CreateStreamer(MeshStreamer* streamer, int workerCount, size_t residentBudget, size_t uploadBudget)
+{
+	assert(workerCount > 0, "Streaming needs at least one worker");
+	streamer->residentBudget = residentBudget;
+	streamer->uploadBudget = uploadBudget;
+	streamer->quit = false;
+	for (int i = 0; i < workerCount; i++)
+		streamer->workers.emplace_back(StreamWorker, streamer);
+}
+
+void DestroyStreamer(MeshStreamer* streamer)
+{
+	{
+		std::lock_guard<std::mutex> lock(streamer->mutex);
+		streamer->quit = true;
+	}
+	streamer->wake.notify_all();
+	for (std::thread& worker : streamer->workers)
+		worker.join();
+	streamer->workers.clear();
+
+	for (const std::unique_ptr<StreamedMesh>& entry : streamer->meshes)
+	{
+		if (entry->state == STREAM_RESIDENT)
+			DestroyMesh(&entry->mesh);
+	}
+	streamer->meshes.clear();
+	streamer->requests.clear();
+	streamer->decoded.clear();
+	streamer->residentBytes = 0;
+}
+
+int RequestMesh(MeshStreamer* streamer, const char* path, VertexLayout layout, IndexFormat format)
+{
+	for (size_t i = 0; i < streamer->meshes.size(); i++)
+	{
+		if (streamer->meshes[i]->path == path)
+			return (int)i;
+	}
+
+	std::unique_ptr<StreamedMesh> entry(new StreamedMesh);
+	entry->path = path;
+	entry->format = format;
+	entry->mesh.layout = layout;
+	entry->lastUsed = streamer->frame;
+	Enqueue(streamer, entry.get());
+
+	streamer->meshes.push_back(std::move(entry));
+	return (int)streamer->meshes.size() - 1;
+}
+
+const Mesh* AcquireMesh(MeshStreamer* streamer, int handle)
+{
+	StreamedMesh* entry = streamer->meshes[handle].get();
+	entry->lastUsed = streamer->frame;
+
+	StreamState state = entry->state;
+	if (state == STREAM_RESIDENT)
+		return &entry->mesh;
+
+	if (state == STREAM_UNLOADED)
+		Enqueue(streamer, entry);
+	return nullptr;
+}
+
+void UpdateStreamer(MeshStreamer* streamer)
+{
+	streamer->frame++;
+
+	// Take as many decoded meshes as fit in this frame's upload budget
+	std::vector<StreamedMesh*> uploads;
+	{
+		std::lock_guard<std::mutex> lock(streamer->mutex);
+		size_t bytes = 0;
+		while (!streamer->decoded.empty())
+		{
+			size_t size = GpuBytes(streamer->decoded.front()->mesh);
+			if (!uploads.empty() && bytes + size > streamer->uploadBudget)
+				break;
+
+			bytes += size;
+			uploads.push_back(streamer->decoded.front());
+			streamer->decoded.pop_front();
+		}
+	}
+
+	for (StreamedMesh* entry : uploads)
+	{
+		size_t bytes = GpuBytes(entry->mesh);
+		Evict(streamer, bytes);
+		Upload(&entry->mesh);
+		ReleaseCpuData(&entry->mesh);
+
+		entry->gpuBytes = bytes;
+		entry->state = STREAM_RESIDENT;
+		streamer->residentBytes += bytes;
+	}
+
+	// Meshes that stopped being drawn are released even when nothing new arrives
+	Evict(streamer, 0);
+}
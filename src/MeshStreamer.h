@@ -0,0 +1,63 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Mesh.h"
+
+enum StreamState
+{
+	STREAM_UNLOADED,	// Not requested yet, or evicted
+	STREAM_QUEUED,		// Waiting for or being decoded by a worker
+	STREAM_DECODED,		// CPU data ready, waiting for the GL thread to upload it
+	STREAM_RESIDENT		// GPU buffers alive, CPU data released
+};
+
+struct StreamedMesh
+{
+	std::string path;
+	IndexFormat format = INDEX_AUTO;
+	Mesh mesh;
+	std::atomic<StreamState> state{ STREAM_UNLOADED };
+	size_t gpuBytes = 0;
+	uint64_t lastUsed = 0;	// Frame this mesh was last acquired in
+};
+
+// Loads meshes on worker threads and uploads them on the GL thread under a per-frame byte budget.
+// Resident meshes are evicted least-recently-drawn first once residentBudget is exceeded, and reload on their next use.
+struct MeshStreamer
+{
+	size_t uploadBudget = 0;	// Bytes uploaded per UpdateStreamer (at least one mesh is always uploaded)
+	size_t residentBudget = 0;	// GPU bytes kept resident before evicting
+	size_t residentBytes = 0;
+	uint64_t frame = 0;
+
+	// Only touched by the GL thread. Workers see entries through the queues, which never outlive them.
+	std::vector<std::unique_ptr<StreamedMesh>> meshes;
+
+	std::mutex mutex;
+	std::condition_variable wake;
+	std::deque<StreamedMesh*> requests;	// Waiting for a worker
+	std::deque<StreamedMesh*> decoded;	// Waiting for the GL thread
+	std::vector<std::thread> workers;
+	bool quit = false;
+};
+
+void CreateStreamer(MeshStreamer* streamer, int workerCount = 2, size_t residentBudget = 256 << 20, size_t uploadBudget = 8 << 20);
+void DestroyStreamer(MeshStreamer* streamer);
+
+// Returns a handle for the mesh at path (the same handle if it was requested before) and starts loading it in the background
+int RequestMesh(MeshStreamer* streamer, const char* path, VertexLayout layout = LAYOUT_SEPARATE, IndexFormat format = INDEX_AUTO);
+
+// Returns the mesh if it's resident, otherwise nullptr (skip the draw) and makes sure it's being loaded. Never blocks.
+const Mesh* AcquireMesh(MeshStreamer* streamer, int handle);
+
+// Call once per frame on the GL thread before drawing: uploads decoded meshes and evicts meshes over budget.
+// Meshes acquired during the previous frame are never evicted, so the visible set may temporarily exceed the budget.
+void UpdateStreamer(MeshStreamer* streamer);
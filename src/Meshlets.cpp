@@ -0,0 +1,235 @@
+#include "Meshlets.h"
+#include "Mesh.h"
+#include "MeshOptimizer.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <numeric>
+
+// Bounding sphere of the meshlet's vertices and the cone containing all its triangle normals
+static void ComputeMeshletBounds(Meshlet* meshlet, const uint32_t* indices, const Vector3* positions, const Vector3* normals)
+{
+	Vector3 min = positions[indices[0]], max = positions[indices[0]];
+	for (int i = 0; i < meshlet->count; i++)
+	{
+		Vector3 p = positions[indices[i]];
+		min = { Min(min.x, p.x), Min(min.y, p.y), Min(min.z, p.z) };
+		max = { Max(max.x, p.x), Max(max.y, p.y), Max(max.z, p.z) };
+	}
+
+	meshlet->center = (min + max) * 0.5f;
+	meshlet->radius = 0.0f;
+	for (int i = 0; i < meshlet->count; i++)
+		meshlet->radius = Max(meshlet->radius, Length(positions[indices[i]] - meshlet->center));
+
+	Vector3 axis = V3_ZERO;
+	for (int t = 0; t < meshlet->count / 3; t++)
+		axis = axis + normals[t];
+	if (Length(axis) <= 0.0f)
+		return;
+
+	axis = Normalize(axis);
+	float minDot = 1.0f;
+	for (int t = 0; t < meshlet->count / 3; t++)
+	{
+		if (LengthSqr(normals[t]) > 0.0f)
+			minDot = Min(minDot, Dot(axis, normals[t]));
+	}
+
+	// Normals spread over a hemisphere or more: some triangle always faces the camera
+	if (minDot <= 0.0f)
+		return;
+
+	// Move the apex back along the axis until it's behind every triangle's plane, so any camera
+	// that sees the apex from inside the cone also sees every triangle from behind
+	float maxT = 0.0f;
+	for (int t = 0; t < meshlet->count / 3; t++)
+	{
+		if (LengthSqr(normals[t]) > 0.0f)
+			maxT = Max(maxT, Dot(meshlet->center - positions[indices[t * 3]], normals[t]) / Dot(axis, normals[t]));
+	}
+
+	meshlet->coneApex = meshlet->center - axis * maxT;
+	meshlet->coneAxis = axis;
+	meshlet->coneCutoff = sqrtf(1.0f - minDot * minDot);
+}
+
+void BuildMeshlets(Mesh* mesh, const char* name)
+{
+	mesh->meshlets.clear();
+	if (mesh->indices.empty() || !mesh->ranges.empty())
+		return;
+
+	const std::vector<uint32_t>& indices = mesh->indices;
+	const Vector3* positions = mesh->positions.data();
+	int vertexCount = (int)mesh->positions.size();
+	int triangleCount = (int)indices.size() / 3;
+
+	// Adjacency goes through positions rather than vertices so meshlets grow across uv & normal seams
+	std::vector<uint32_t> order(vertexCount);
+	std::iota(order.begin(), order.end(), 0u);
+	std::sort(order.begin(), order.end(), [positions](uint32_t a, uint32_t b)
+	{
+		return memcmp(&positions[a], &positions[b], sizeof(Vector3)) < 0;
+	});
+
+	std::vector<int> group(vertexCount);
+	int groupCount = 0;
+	for (int i = 0; i < vertexCount; i++)
+	{
+		if (i > 0 && memcmp(&positions[order[i]], &positions[order[i - 1]], sizeof(Vector3)) != 0)
+			groupCount++;
+		group[order[i]] = groupCount;
+	}
+	groupCount++;
+
+	std::vector<int> adjacencyOffsets(groupCount + 1, 0);
+	for (uint32_t v : indices)
+		adjacencyOffsets[group[v] + 1]++;
+	for (int g = 0; g < groupCount; g++)
+		adjacencyOffsets[g + 1] += adjacencyOffsets[g];
+	std::vector<int> adjacency(indices.size());
+	std::vector<int> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+	for (int i = 0; i < (int)indices.size(); i++)
+		adjacency[fill[group[indices[i]]]++] = i / 3;
+
+	std::vector<Vector3> normals(triangleCount);
+	for (int t = 0; t < triangleCount; t++)
+	{
+		Vector3 p0 = positions[indices[t * 3]], p1 = positions[indices[t * 3 + 1]], p2 = positions[indices[t * 3 + 2]];
+		Vector3 normal = Cross(p1 - p0, p2 - p0);
+		normals[t] = Length(normal) > 0.0f ? Normalize(normal) : V3_ZERO;
+	}
+
+	std::vector<uint32_t> reordered;
+	std::vector<Vector3> reorderedNormals;
+	reordered.reserve(indices.size());
+	reorderedNormals.reserve(triangleCount);
+
+	std::vector<uint8_t> emitted(triangleCount, 0);
+	std::vector<int> slot(vertexCount, -1);	// Index of each vertex within the current meshlet
+	std::vector<int> meshletVertices;
+	std::vector<int> candidates;
+	Vector3 normalSum = V3_ZERO;
+	int meshletTriangles = 0;
+	int totalVertices = 0;
+	int seed = 0;
+
+	auto newVertices = [&](int t)
+	{
+		return (slot[indices[t * 3]] < 0) + (slot[indices[t * 3 + 1]] < 0) + (slot[indices[t * 3 + 2]] < 0);
+	};
+
+	auto finish = [&]()
+	{
+		if (meshletTriangles == 0)
+			return;
+
+		Meshlet meshlet;
+		meshlet.count = meshletTriangles * 3;
+		meshlet.offset = (int)reordered.size() - meshlet.count;
+		mesh->meshlets.push_back(meshlet);
+
+		totalVertices += (int)meshletVertices.size();
+		for (int v : meshletVertices)
+			slot[v] = -1;
+		meshletVertices.clear();
+		candidates.clear();
+		normalSum = V3_ZERO;
+		meshletTriangles = 0;
+	};
+
+	for (;;)
+	{
+		// Fewest new vertices first, then the one facing closest to the meshlet's average normal
+		int best = -1;
+		int bestNew = 4;
+		float bestDot = -2.0f;
+		size_t write = 0;
+		for (int t : candidates)
+		{
+			if (emitted[t])
+				continue;
+
+			candidates[write++] = t;
+			int added = newVertices(t);
+			float dot = Dot(normals[t], normalSum);
+			if (added < bestNew || (added == bestNew && dot > bestDot))
+			{
+				best = t;
+				bestNew = added;
+				bestDot = dot;
+			}
+		}
+		candidates.resize(write);
+
+		bool full = best >= 0 &&
+			((int)meshletVertices.size() + bestNew > MESHLET_MAX_VERTICES || meshletTriangles == MESHLET_MAX_TRIANGLES);
+
+		// Start a new meshlet from the next unused triangle in cache order once this one is full or its surface ran out
+		if (best < 0 || full)
+		{
+			finish();
+			while (seed < triangleCount && emitted[seed])
+				seed++;
+			if (seed == triangleCount)
+				break;
+			best = seed;
+		}
+
+		emitted[best] = 1;
+		for (int k = 0; k < 3; k++)
+		{
+			uint32_t v = indices[best * 3 + k];
+			reordered.push_back(v);
+			if (slot[v] < 0)
+			{
+				slot[v] = (int)meshletVertices.size();
+				meshletVertices.push_back(v);
+			}
+
+			int g = group[v];
+			for (int a = adjacencyOffsets[g]; a < adjacencyOffsets[g + 1]; a++)
+			{
+				if (!emitted[adjacency[a]])
+					candidates.push_back(adjacency[a]);
+			}
+		}
+		reorderedNormals.push_back(normals[best]);
+		normalSum = normalSum + normals[best];
+		meshletTriangles++;
+	}
+	finish();
+
+	mesh->indices.swap(reordered);
+	for (Meshlet& meshlet : mesh->meshlets)
+		ComputeMeshletBounds(&meshlet, &mesh->indices[meshlet.offset], positions, &reorderedNormals[meshlet.offset / 3]);
+
+	int count = (int)mesh->meshlets.size();
+	int cullable = 0;
+	for (const Meshlet& meshlet : mesh->meshlets)
+		cullable += meshlet.coneCutoff <= 1.0f;
+
+	VertexCacheStats stats = AnalyzeVertexCache(mesh->indices.data(), (int)mesh->indices.size(), vertexCount);
+	printf("Mesh %s: %d meshlets, %.1f vertices & %.1f triangles on average, %d%% cone-cullable, ACMR %.3f\n",
+		name, count, (float)totalVertices / count, (float)triangleCount / count, 100 * cullable / count, stats.acmr);
+}
+
+int CullMeshlets(const Meshlet* meshlets, int count, const ViewFrustum& frustum, Vector3 camera, int* visible)
+{
+	int visibleCount = 0;
+	for (int i = 0; i < count; i++)
+	{
+		const Meshlet& meshlet = meshlets[i];
+		if (!SphereInFrustum(frustum, meshlet.center, meshlet.radius))
+			continue;
+
+		Vector3 view = meshlet.coneApex - camera;
+		float distance = Length(view);
+		if (distance > 0.0f && Dot(view, meshlet.coneAxis) >= meshlet.coneCutoff * distance)
+			continue;
+
+		visible[visibleCount++] = i;
+	}
+	return visibleCount;
+}
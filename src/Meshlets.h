@@ -0,0 +1,14 @@
+#pragma once
+#include "Math.h"
+
+struct Mesh;
+struct Meshlet;
+
+// Greedily grows meshlets of up to MESHLET_MAX_VERTICES vertices & MESHLET_MAX_TRIANGLES triangles from connected triangles,
+// preferring ones that add the fewest vertices and face the same way. Reorders mesh->indices so each meshlet is contiguous,
+// then computes every meshlet's bounding sphere & normal cone and prints how well the clusters are filled.
+void BuildMeshlets(Mesh* mesh, const char* name);
+
+// Writes the indices of meshlets that intersect the frustum and may have a triangle facing the camera, and returns how many.
+// Frustum & camera must be in the mesh's object space (ie ExtractFrustum(world * view * proj)), and world must scale uniformly.
+int CullMeshlets(const Meshlet* meshlets, int count, const ViewFrustum& frustum, Vector3 camera, int* visible);
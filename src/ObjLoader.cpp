@@ -0,0 +1,417 @@
+#include "ObjLoader.h"
+#include "MeshCache.h"
+#include "Parallel.h"
+#include <algorithm>
+#include <cstring>
+#include <string>
+#define FAST_OBJ_IMPLEMENTATION
+#include <fast_obj.h>
+
+// Smallest chunk handed to a thread, below this the spawn cost outweighs the parsing
+static const size_t OBJ_CHUNK_BYTES = 1 << 20;
+
+// Corner flags marking negative (relative) indices, which are chunk-local until the merge
+enum : uint8_t
+{
+	RELATIVE_P = 1 << 0,
+	RELATIVE_T = 1 << 1,
+	RELATIVE_N = 1 << 2
+};
+
+struct ObjChunk
+{
+	const char* begin;
+	const char* end;
+	std::vector<Vector3> positions;
+	std::vector<Vector3> normals;
+	std::vector<Vector2> tcoords;
+	std::vector<ObjCorner> corners;
+	std::vector<uint8_t> relative;	// Per-corner RELATIVE_ flags, empty if the chunk has no relative indices
+};
+
+static inline bool IsWhitespace(char c)
+{
+	return c == ' ' || c == '\t' || c == '\r';
+}
+
+static inline bool IsDigit(char c)
+{
+	return c >= '0' && c <= '9';
+}
+
+static inline const char* SkipWhitespace(const char* ptr)
+{
+	while (IsWhitespace(*ptr))
+		ptr++;
+	return ptr;
+}
+
+static inline const char* SkipLine(const char* ptr)
+{
+	while (*ptr++ != '\n')
+		;
+	return ptr;
+}
+
+static const char* ParseInt(const char* ptr, int* value)
+{
+	int sign = 1;
+	if (*ptr == '-')
+	{
+		sign = -1;
+		ptr++;
+	}
+
+	int num = 0;
+	while (IsDigit(*ptr))
+		num = 10 * num + (*ptr++ - '0');
+	*value = sign * num;
+	return ptr;
+}
+
+// Same arithmetic & power tables (MAX_POWER, POWER_10_POS/NEG) as fast_obj's parse_float so both loaders round identically
+static const char* ParseFloat(const char* ptr, float* value)
+{
+	ptr = SkipWhitespace(ptr);
+
+	double sign = 1.0;
+	if (*ptr == '+' || *ptr == '-')
+		sign = *ptr++ == '-' ? -1.0 : 1.0;
+
+	double num = 0.0;
+	while (IsDigit(*ptr))
+		num = 10.0 * num + (double)(*ptr++ - '0');
+
+	if (*ptr == '.')
+		ptr++;
+
+	double fra = 0.0;
+	double div = 1.0;
+	while (IsDigit(*ptr))
+	{
+		fra = 10.0 * fra + (double)(*ptr++ - '0');
+		div *= 10.0;
+	}
+	num += fra / div;
+
+	if (*ptr == 'e' || *ptr == 'E')
+	{
+		ptr++;
+		const double* powers = POWER_10_POS;
+		if (*ptr == '+' || *ptr == '-')
+			powers = *ptr++ == '-' ? POWER_10_NEG : POWER_10_POS;
+
+		unsigned int exponent = 0;
+		while (IsDigit(*ptr))
+			exponent = 10 * exponent + (*ptr++ - '0');
+		num *= exponent >= MAX_POWER ? 0.0 : powers[exponent];
+	}
+
+	*value = (float)(sign * num);
+	return ptr;
+}
+
+// Resolves an obj index to fast_obj's 1-based convention, flagging negative indices that still need the chunk's base
+static inline uint32_t ResolveIndex(int index, size_t localCount, uint8_t flag, uint8_t* relative)
+{
+	if (index >= 0)
+		return (uint32_t)index;
+
+	*relative |= flag;
+	return (uint32_t)((int64_t)localCount + index);
+}
+
+static void ParseFace(ObjChunk* chunk, const char* ptr)
+{
+	ObjCorner corners[3];
+	uint8_t flags[3];
+	int count = 0;
+
+	ptr = SkipWhitespace(ptr);
+	while (*ptr != '\n')
+	{
+		int p = 0, t = 0, n = 0;
+		ptr = ParseInt(ptr, &p);
+		if (*ptr == '/')
+		{
+			ptr++;
+			if (*ptr != '/')
+				ptr = ParseInt(ptr, &t);
+			if (*ptr == '/')
+			{
+				ptr++;
+				ptr = ParseInt(ptr, &n);
+			}
+		}
+
+		// Like fast_obj, a corner without a position ends the face
+		if (p == 0)
+			return;
+
+		ObjCorner corner;
+		uint8_t relative = 0;
+		corner.p = ResolveIndex(p, chunk->positions.size(), RELATIVE_P, &relative);
+		corner.t = ResolveIndex(t, chunk->tcoords.size(), RELATIVE_T, &relative);
+		corner.n = ResolveIndex(n, chunk->normals.size(), RELATIVE_N, &relative);
+
+		// Fan-triangulate as corners arrive: (first, previous, current)
+		if (count < 2)
+		{
+			corners[count] = corner;
+			flags[count] = relative;
+		}
+		else
+		{
+			corners[2] = corner;
+			flags[2] = relative;
+			// Flags are only stored once a chunk has seen a relative index, earlier corners are padded with zeros
+			if ((flags[0] | flags[1] | flags[2]) != 0 || !chunk->relative.empty())
+			{
+				chunk->relative.resize(chunk->corners.size(), 0);
+				chunk->relative.insert(chunk->relative.end(), flags, flags + 3);
+			}
+			chunk->corners.insert(chunk->corners.end(), corners, corners + 3);
+			corners[1] = corner;
+			flags[1] = relative;
+		}
+		count++;
+		ptr = SkipWhitespace(ptr);
+	}
+}
+
+static void ParseChunk(ObjChunk* chunk)
+{
+	const char* p = chunk->begin;
+	while (p != chunk->end)
+	{
+		p = SkipWhitespace(p);
+		if (p[0] == 'v' && (p[1] == ' ' || p[1] == '\t'))
+		{
+			Vector3 v;
+			p = ParseFloat(p + 2, &v.x);
+			p = ParseFloat(p, &v.y);
+			p = ParseFloat(p, &v.z);
+			chunk->positions.push_back(v);
+		}
+		else if (p[0] == 'v' && p[1] == 't')
+		{
+			Vector2 v;
+			p = ParseFloat(p + 2, &v.x);
+			p = ParseFloat(p, &v.y);
+			chunk->tcoords.push_back(v);
+		}
+		else if (p[0] == 'v' && p[1] == 'n')
+		{
+			Vector3 v;
+			p = ParseFloat(p + 2, &v.x);
+			p = ParseFloat(p, &v.y);
+			p = ParseFloat(p, &v.z);
+			chunk->normals.push_back(v);
+		}
+		else if (p[0] == 'f' && (p[1] == ' ' || p[1] == '\t'))
+		{
+			ParseFace(chunk, p + 2);
+		}
+		p = SkipLine(p);
+	}
+}
+
+// Points the arrays at the storage vectors
+static void UseStorage(ObjData* obj)
+{
+	obj->positions = obj->positionStorage.data();
+	obj->normals = obj->normalStorage.data();
+	obj->tcoords = obj->tcoordStorage.data();
+	obj->corners = obj->cornerStorage.data();
+	obj->positionCount = obj->positionStorage.size();
+	obj->normalCount = obj->normalStorage.size();
+	obj->tcoordCount = obj->tcoordStorage.size();
+	obj->cornerCount = obj->cornerStorage.size();
+}
+
+// For files that would only be one chunk anyway. Attributes are used in place, as are the corners of triangle-only files.
+static bool ReadObjSerial(const char* path, ObjData* obj)
+{
+	fastObjMesh* mesh = fast_obj_read(path);
+	if (mesh == nullptr)
+		return false;
+
+	// Both keep the same dummy element at index 0, and fastObjIndex matches ObjCorner
+	static_assert(sizeof(fastObjIndex) == sizeof(ObjCorner), "fastObjIndex must match ObjCorner");
+	obj->fastObj = mesh;
+	obj->positions = (const Vector3*)mesh->positions;
+	obj->normals = (const Vector3*)mesh->normals;
+	obj->tcoords = (const Vector2*)mesh->texcoords;
+	obj->positionCount = mesh->position_count;
+	obj->normalCount = mesh->normal_count;
+	obj->tcoordCount = mesh->texcoord_count;
+
+	size_t cornerCount = 0;
+	for (unsigned int face = 0; face < mesh->face_count; face++)
+		cornerCount += mesh->face_vertices[face] > 2 ? (mesh->face_vertices[face] - 2) * 3 : 0;
+
+	const ObjCorner* corners = (const ObjCorner*)mesh->indices;
+	if (cornerCount == mesh->index_count && cornerCount == (size_t)mesh->face_count * 3)
+	{
+		obj->corners = corners;
+		obj->cornerCount = cornerCount;
+		return true;
+	}
+
+	// Same fan as ParseFace: (first, previous, current)
+	obj->cornerStorage.reserve(cornerCount);
+	for (unsigned int face = 0; face < mesh->face_count; face++)
+	{
+		unsigned int count = mesh->face_vertices[face];
+		for (unsigned int i = 2; i < count; i++)
+		{
+			obj->cornerStorage.push_back(corners[0]);
+			obj->cornerStorage.push_back(corners[i - 1]);
+			obj->cornerStorage.push_back(corners[i]);
+		}
+		corners += count;
+	}
+	obj->corners = obj->cornerStorage.data();
+	obj->cornerCount = cornerCount;
+	return true;
+}
+
+bool ReadObj(const char* path, ObjData* obj)
+{
+	MappedFile file;
+	if (!MapFile(&file, path))
+		return false;
+
+	// A single chunk has nothing to run in parallel, and fast_obj_read parses it faster than ParseChunk and without copies
+	size_t workers = std::max(std::thread::hardware_concurrency(), 1u);
+	size_t chunkBytes = std::max(OBJ_CHUNK_BYTES, file.size / workers + 1);
+	if (file.size <= chunkBytes)
+	{
+		UnmapFile(&file);
+		return ReadObjSerial(path, obj);
+	}
+
+	const char* data = (const char*)file.data;
+	const char* end = data + file.size;
+
+	// Every line must end in a newline since the parser never checks for the end of the buffer,
+	// so an unterminated last line is parsed from a copy instead of the mapping.
+	std::string tail;
+	const char* lastLine = end;
+	if (end[-1] != '\n')
+	{
+		while (lastLine > data && lastLine[-1] != '\n')
+			lastLine--;
+		tail.assign(lastLine, end);
+		tail.push_back('\n');
+	}
+
+	// Line-aligned chunks, about one per core
+	std::vector<ObjChunk> chunks;
+	for (const char* begin = data; begin < lastLine;)
+	{
+		const char* chunkEnd = lastLine;
+		if ((size_t)(lastLine - begin) > chunkBytes)
+		{
+			const char* newline = (const char*)memchr(begin + chunkBytes, '\n', lastLine - (begin + chunkBytes));
+			chunkEnd = newline != nullptr ? newline + 1 : lastLine;
+		}
+		chunks.emplace_back();
+		chunks.back().begin = begin;
+		chunks.back().end = chunkEnd;
+		begin = chunkEnd;
+	}
+	if (!tail.empty())
+	{
+		chunks.emplace_back();
+		chunks.back().begin = tail.data();
+		chunks.back().end = tail.data() + tail.size();
+	}
+
+	// The first chunk holds fast_obj's dummy elements, so relative indices and offsets need no special case for them
+	chunks[0].positions.push_back(Vector3{ 0.0f, 0.0f, 0.0f });
+	chunks[0].normals.push_back(Vector3{ 0.0f, 0.0f, 1.0f });
+	chunks[0].tcoords.push_back(Vector2{ 0.0f, 0.0f });
+
+	int chunkCount = (int)chunks.size();
+	ParallelFor(chunkCount, 1, [&](int first, int last)
+	{
+		for (int i = first; i < last; i++)
+			ParseChunk(&chunks[i]);
+	});
+
+	// A single chunk is already the final layout
+	if (chunkCount == 1)
+	{
+		obj->positionStorage = std::move(chunks[0].positions);
+		obj->normalStorage = std::move(chunks[0].normals);
+		obj->tcoordStorage = std::move(chunks[0].tcoords);
+		obj->cornerStorage = std::move(chunks[0].corners);
+		UseStorage(obj);
+		UnmapFile(&file);
+		return true;
+	}
+
+	// Prefix sums give every chunk its output offsets
+	std::vector<size_t> positionBase(chunkCount), normalBase(chunkCount), tcoordBase(chunkCount), cornerBase(chunkCount);
+	size_t positionCount = 0, normalCount = 0, tcoordCount = 0, cornerCount = 0;
+	for (int i = 0; i < chunkCount; i++)
+	{
+		positionBase[i] = positionCount;
+		normalBase[i] = normalCount;
+		tcoordBase[i] = tcoordCount;
+		cornerBase[i] = cornerCount;
+		positionCount += chunks[i].positions.size();
+		normalCount += chunks[i].normals.size();
+		tcoordCount += chunks[i].tcoords.size();
+		cornerCount += chunks[i].corners.size();
+	}
+
+	obj->positionStorage.resize(positionCount);
+	obj->normalStorage.resize(normalCount);
+	obj->tcoordStorage.resize(tcoordCount);
+	obj->cornerStorage.resize(cornerCount);
+
+	ParallelFor(chunkCount, 1, [&](int first, int last)
+	{
+		for (int i = first; i < last; i++)
+		{
+			ObjChunk& chunk = chunks[i];
+			std::copy(chunk.positions.begin(), chunk.positions.end(), obj->positionStorage.begin() + positionBase[i]);
+			std::copy(chunk.normals.begin(), chunk.normals.end(), obj->normalStorage.begin() + normalBase[i]);
+			std::copy(chunk.tcoords.begin(), chunk.tcoords.end(), obj->tcoordStorage.begin() + tcoordBase[i]);
+
+			// Relative indices were counted from the chunk's first attribute, absolute ones are already final
+			ObjCorner* out = obj->cornerStorage.data() + cornerBase[i];
+			if (chunk.relative.empty())
+			{
+				std::copy(chunk.corners.begin(), chunk.corners.end(), out);
+				continue;
+			}
+
+			for (size_t c = 0; c < chunk.corners.size(); c++)
+			{
+				ObjCorner corner = chunk.corners[c];
+				uint8_t relative = chunk.relative[c];
+				if (relative & RELATIVE_P)
+					corner.p += (uint32_t)positionBase[i];
+				if (relative & RELATIVE_T)
+					corner.t += (uint32_t)tcoordBase[i];
+				if (relative & RELATIVE_N)
+					corner.n += (uint32_t)normalBase[i];
+				out[c] = corner;
+			}
+		}
+	});
+
+	UseStorage(obj);
+	UnmapFile(&file);
+	return true;
+}
+
+void DestroyObj(ObjData* obj)
+{
+	if (obj->fastObj != nullptr)
+		fast_obj_destroy(obj->fastObj);
+	*obj = ObjData();
+}
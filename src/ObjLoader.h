@@ -0,0 +1,42 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <fast_obj.h>
+#include "Math.h"
+
+// 1-based attribute indices of one face corner, 0 if the attribute is missing (same convention as fast_obj)
+struct ObjCorner
+{
+	uint32_t p;
+	uint32_t t;
+	uint32_t n;
+};
+
+// Attribute arrays keep a dummy element at index 0 so corners index them directly. The arrays point into the storage
+// vectors when the file was parsed in parallel, or into fast_obj's mesh when it was read in one piece.
+struct ObjData
+{
+	const Vector3* positions = nullptr;
+	const Vector3* normals = nullptr;
+	const Vector2* tcoords = nullptr;
+	const ObjCorner* corners = nullptr;	// 3 per triangle, polygons are fan-triangulated
+	size_t positionCount = 0;
+	size_t normalCount = 0;
+	size_t tcoordCount = 0;
+	size_t cornerCount = 0;
+
+	std::vector<Vector3> positionStorage;
+	std::vector<Vector3> normalStorage;
+	std::vector<Vector2> tcoordStorage;
+	std::vector<ObjCorner> cornerStorage;
+	fastObjMesh* fastObj = nullptr;
+};
+
+// Memory-maps the obj, parses line-aligned chunks of it on all cores and merges them with prefix sums.
+// Files that fit in one chunk (or any file on a single core) are read with fast_obj_read instead, without copying.
+// Numbers are parsed exactly like fast_obj so triangle meshes load bit-identical either way.
+// Only v, vt, vn & f records are read; objects, groups and materials are ignored.
+bool ReadObj(const char* path, ObjData* obj);
+
+// Frees the fast_obj mesh (if any) along with the storage
+void DestroyObj(ObjData* obj);
@@ -0,0 +1,32 @@
+#pragma once
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+// Splits [0, count) into contiguous ranges of at least grain elements and calls fn(begin, end) for each range.
+// The calling thread processes the first range, so small workloads never leave the current thread.
+template<typename Fn>
+inline void ParallelFor(int count, int grain, Fn fn)
+{
+    int workers = (int)std::thread::hardware_concurrency();
+    int ranges = std::min(std::max(workers, 1), (count + grain - 1) / std::max(grain, 1));
+    if (ranges <= 1)
+    {
+        if (count > 0)
+            fn(0, count);
+        return;
+    }
+
+    int size = (count + ranges - 1) / ranges;
+    std::vector<std::thread> threads;
+    threads.reserve(ranges - 1);
+    for (int begin = size; begin < count; begin += size)
+    {
+        int end = std::min(begin + size, count);
+        threads.emplace_back([&fn, begin, end]() { fn(begin, end); });
+    }
+
+    fn(0, std::min(size, count));
+    for (std::thread& thread : threads)
+        thread.join();
+}
@@ -0,0 +1,102 @@
+#include "RingBuffer.h"
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+
+void CreateRingBuffer(RingBuffer* ring, size_t frameSize)
+{
+	GLint uniformAlignment = 0, storageAlignment = 0;
+	glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &uniformAlignment);
+	glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &storageAlignment);
+	ring->alignment = (size_t)std::max(std::max(uniformAlignment, storageAlignment), 16);
+
+	// Regions start aligned so offsets within them only need aligning relative to the region
+	ring->frameSize = (frameSize + ring->alignment - 1) / ring->alignment * ring->alignment;
+	size_t size = ring->frameSize * RING_FRAMES;
+	GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+	glCreateBuffers(1, &ring->buffer);
+	glNamedBufferStorage(ring->buffer, size, nullptr, flags);
+	ring->data = (uint8_t*)glMapNamedBufferRange(ring->buffer, 0, size, flags);
+	assert(ring->data != nullptr, "Failed to map ring buffer");
+
+	ring->frame = 0;
+	ring->head = 0;
+	ring->waits = 0;
+	for (GLsync& fence : ring->fences)
+		fence = nullptr;
+}
+
+void DestroyRingBuffer(RingBuffer* ring)
+{
+	for (GLsync& fence : ring->fences)
+	{
+		if (fence != nullptr)
+			glDeleteSync(fence);
+	}
+
+	glUnmapNamedBuffer(ring->buffer);
+	glDeleteBuffers(1, &ring->buffer);
+	*ring = {};
+}
+
+void BeginRingFrame(RingBuffer* ring)
+{
+	ring->frame = (ring->frame + 1) % RING_FRAMES;
+	ring->head = 0;
+
+	GLsync& fence = ring->fences[ring->frame];
+	if (fence == nullptr)
+		return;
+
+	// Flush on the first try so the fence is guaranteed to signal, then block in 1ms slices until it does
+	GLenum status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+	if (status == GL_TIMEOUT_EXPIRED)
+	{
+		ring->waits++;
+		do
+			status = glClientWaitSync(fence, 0, 1000000);
+		while (status == GL_TIMEOUT_EXPIRED);
+	}
+	assert(status != GL_WAIT_FAILED, "Ring buffer fence wait failed");
+
+	glDeleteSync(fence);
+	fence = nullptr;
+}
+
+void EndRingFrame(RingBuffer* ring)
+{
+	GLsync& fence = ring->fences[ring->frame];
+	if (fence != nullptr)
+		glDeleteSync(fence);
+	fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+RingAllocation RingAllocate(RingBuffer* ring, size_t size, size_t alignment)
+{
+	if (alignment == 0)
+		alignment = ring->alignment;
+
+	RingAllocation allocation;
+	size_t offset = (ring->head + alignment - 1) / alignment * alignment;
+	if (offset + size > ring->frameSize)
+	{
+		assert(false, "Ring buffer region is full, raise frameSize");
+		return allocation;
+	}
+
+	ring->head = offset + size;
+	allocation.buffer = ring->buffer;
+	allocation.offset = ring->frame * ring->frameSize + offset;
+	allocation.size = size;
+	allocation.data = ring->data + allocation.offset;
+	return allocation;
+}
+
+size_t RingAvailable(const RingBuffer* ring, size_t alignment)
+{
+	if (alignment == 0)
+		alignment = ring->alignment;
+
+	size_t offset = (ring->head + alignment - 1) / alignment * alignment;
+	return offset < ring->frameSize ? ring->frameSize - offset : 0;
+}
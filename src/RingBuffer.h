@@ -0,0 +1,47 @@
+#pragma once
+#include <glad/glad.h>
+#include <cstddef>
+#include <cstdint>
+
+// Frames the CPU may run ahead of the GPU, each with its own region of the ring
+constexpr int RING_FRAMES = 3;
+
+// Persistently mapped (coherent) buffer for data that changes every frame. Each frame bump-allocates from its own region,
+// which is fenced at the end of the frame and only reused once the GPU has passed that fence, so writes never stall on
+// draws still reading them and no glBufferData/glBufferSubData copies are made.
+struct RingBuffer
+{
+	GLuint buffer = GL_NONE;
+	uint8_t* data = nullptr;	// Whole buffer, mapped for its lifetime
+	size_t frameSize = 0;		// Bytes per region
+	size_t alignment = 0;		// Default allocation alignment, enough to bind any allocation as a uniform or storage buffer
+	int frame = 0;				// Region being written
+	size_t head = 0;			// Bytes used in the current region
+	GLsync fences[RING_FRAMES] = {};
+	int waits = 0;				// Times BeginRingFrame had to wait on the GPU, for tuning RING_FRAMES & frameSize
+};
+
+// Where an allocation lives, for binding (buffer + offset) and for writing (data). data is null if the region was full.
+struct RingAllocation
+{
+	void* data = nullptr;
+	GLuint buffer = GL_NONE;
+	size_t offset = 0;
+	size_t size = 0;
+};
+
+void CreateRingBuffer(RingBuffer* ring, size_t frameSize = 4 << 20);
+void DestroyRingBuffer(RingBuffer* ring);
+
+// Call at the start of every frame before allocating: moves to the next region, waiting for its fence if the GPU is behind
+void BeginRingFrame(RingBuffer* ring);
+
+// Call once the frame's draws have been issued (ie before swapping buffers) to fence the region they read
+void EndRingFrame(RingBuffer* ring);
+
+// Bump allocates size bytes from the current frame's region. Valid until the frame's fence is passed, so write & draw this frame.
+// alignment 0 uses ring->alignment.
+RingAllocation RingAllocate(RingBuffer* ring, size_t size, size_t alignment = 0);
+
+// Bytes an allocation with the given alignment could still take from the current frame's region. alignment 0 uses ring->alignment.
+size_t RingAvailable(const RingBuffer* ring, size_t alignment = 0);
@@ -129,21 +129,17 @@ void SendMat3(GLuint shader, const char* name, Matrix value)
     glUniformMatrix3fv(location, 1, GL_FALSE, v.v);
 }
 
+// Matrix memory is the transpose of OpenGL's column-major layout,
+// so we let OpenGL transpose on upload (GL_TRUE) instead of copying with ToFloat16.
 void SendMat4(GLuint shader, const char* name, Matrix value)
 {
     GLint location = GetLocation(shader, name);
-    float16 v = ToFloat16(value);
-    glUniformMatrix4fv(location, 1, GL_FALSE, v.v);
+    glUniformMatrix4fv(location, 1, GL_TRUE, &value.m0);
 }
 
-void SendMat4Array(GLuint shader, const char* name, Matrix* values, int count)
+// Matrices are uploaded straight from the caller's array (no temporary copy)
+void SendMat4Array(GLuint shader, const char* name, const Matrix* values, int count)
 {
     GLint location = GetLocation(shader, name);
-    float16* v = new float16[count];
-    for (int i = 0; i < 100; i++)
-    {
-        v[i] = ToFloat16(values[i]);
-    }
-    glUniformMatrix4fv(location, count, GL_FALSE, (float*)v);
-    delete[] v;
+    glUniformMatrix4fv(location, count, GL_TRUE, &values->m0);
 }
@@ -13,4 +13,4 @@ void SendVec4(GLuint shader, const char* name, Vector4 value);
 void SendMat3(GLuint shader, const char* name, Matrix value);
 void SendMat4(GLuint shader, const char* name, Matrix value);
 
-void SendMat4Array(GLuint shader, const char* name, Matrix* values, int count);
+void SendMat4Array(GLuint shader, const char* name, const Matrix* values, int count);
@@ -1,7 +1,15 @@
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
+#include "Bvh.h"
+#include "DrawBatch.h"
+#include "GeometryArena.h"
 #include "Mesh.h"
+#include "MeshSimplifier.h"
+#include "Meshlets.h"
+#include "MeshStreamer.h"
+#include "RingBuffer.h"
 #include "Shader.h"
+#include "MathSimd.h"
 
 // TODO -- Texture.h & Texture.cpp during lab, show result next lexture
 #define STB_IMAGE_IMPLEMENTATION
@@ -14,6 +22,7 @@
 #include <cstdlib>
 #include <iostream>
 #include <array>
+#include <algorithm>
 
 constexpr int SCREEN_WIDTH = 1280;
 constexpr int SCREEN_HEIGHT = 720;
@@ -114,6 +123,8 @@ void DrawSkybox(GLuint skybox, GLuint shader, const Mesh& cube, Matrix view, Mat
     Matrix mvp = viewSky * proj;
 
     SendMat4(shader, "u_mvp", mvp);
+    if (cube.layout == LAYOUT_QUANTIZED)
+        SendMat4(shader, "u_dequantize", cube.dequantize);
     glActiveTexture(GL_TEXTURE0);
     glBindTexture(GL_TEXTURE_CUBE_MAP, skybox);
     glDepthMask(GL_FALSE);
@@ -123,6 +134,27 @@ void DrawSkybox(GLuint skybox, GLuint shader, const Mesh& cube, Matrix view, Mat
     // Skybox end
 }
 
+// Draws only the meshlets that are on screen & facing the camera (world must scale uniformly)
+void DrawMeshCulled(const Mesh& mesh, Matrix world, Matrix view, Matrix proj, Vector3 camPos)
+{
+    if (mesh.meshlets.empty())
+    {
+        DrawMesh(mesh);
+        return;
+    }
+
+    // Cull in object space so meshlet bounds never need transforming
+    ViewFrustum frustum = ExtractFrustum(world * view * proj);
+    if (!SphereInFrustum(frustum, mesh.sphereCenter, mesh.sphereRadius))
+        return;
+
+    static std::vector<int> visible;
+    visible.resize(mesh.meshlets.size());
+    Vector3 camera = Multiply(camPos, Invert(world));
+    int count = CullMeshlets(mesh.meshlets.data(), (int)mesh.meshlets.size(), frustum, camera, visible.data());
+    DrawMeshlets(mesh, visible.data(), count);
+}
+
 int main(void)
 {
     glfwSetErrorCallback(error_callback);
@@ -154,12 +186,13 @@ int main(void)
 
     // Vertex shaders:
     GLuint vs = CreateShader(GL_VERTEX_SHADER, "./assets/shaders/default.vert");
-    GLuint vsSkybox = CreateShader(GL_VERTEX_SHADER, "./assets/shaders/skybox.vert");
     GLuint vsPoints = CreateShader(GL_VERTEX_SHADER, "./assets/shaders/points.vert");
     GLuint vsLines = CreateShader(GL_VERTEX_SHADER, "./assets/shaders/lines.vert");
     GLuint vsVertexPositionColor = CreateShader(GL_VERTEX_SHADER, "./assets/shaders/vertex_color.vert");
     GLuint vsColorBufferColor = CreateShader(GL_VERTEX_SHADER, "./assets/shaders/buffer_color.vert");
     GLuint vsAsteroids = CreateShader(GL_VERTEX_SHADER, "./assets/shaders/asteroids.vert");
+    GLuint vsQuantized = CreateShader(GL_VERTEX_SHADER, "./assets/shaders/default_quantized.vert");
+    GLuint vsSkyboxQuantized = CreateShader(GL_VERTEX_SHADER, "./assets/shaders/skybox_quantized.vert");
     
     // Fragment shaders:
     GLuint fsSkybox = CreateShader(GL_FRAGMENT_SHADER, "./assets/shaders/skybox.frag");
@@ -176,21 +209,23 @@ int main(void)
     GLuint fsAsteroids = CreateShader(GL_FRAGMENT_SHADER, "./assets/shaders/asteroids.frag");
     
     // Shader programs:
-    GLuint shaderUniformColor = CreateProgram(vs, fsUniformColor);
     GLuint shaderVertexPositionColor = CreateProgram(vsVertexPositionColor, fsVertexColor);
     GLuint shaderVertexBufferColor = CreateProgram(vsColorBufferColor, fsVertexColor);
     GLuint shaderPoints = CreateProgram(vsPoints, fsVertexColor);
     GLuint shaderLines = CreateProgram(vsLines, fsLines);
-    GLuint shaderTcoords = CreateProgram(vs, fsTcoords);
     GLuint shaderNormals = CreateProgram(vs, fsNormals);
-    GLuint shaderTexture = CreateProgram(vs, fsTexture);
-    GLuint shaderTextureMix = CreateProgram(vs, fsTextureMix);
-    GLuint shaderSkybox = CreateProgram(vsSkybox, fsSkybox);
-    GLuint shaderPhong = CreateProgram(vs, fsPhong);
-    GLuint shaderReflect = CreateProgram(vs, fsReflect);
-    GLuint shaderRefract = CreateProgram(vs, fsRefract);
     GLuint shaderAsteroids = CreateProgram(vsAsteroids, fsAsteroids);
 
+    // Shader programs for LAYOUT_QUANTIZED meshes (same fragment shaders, positions expanded by u_dequantize):
+    GLuint shaderUniformColorQuantized = CreateProgram(vsQuantized, fsUniformColor);
+    GLuint shaderTcoordsQuantized = CreateProgram(vsQuantized, fsTcoords);
+    GLuint shaderTextureQuantized = CreateProgram(vsQuantized, fsTexture);
+    GLuint shaderTextureMixQuantized = CreateProgram(vsQuantized, fsTextureMix);
+    GLuint shaderSkyboxQuantized = CreateProgram(vsSkyboxQuantized, fsSkybox);
+    GLuint shaderPhongQuantized = CreateProgram(vsQuantized, fsPhong);
+    GLuint shaderReflectQuantized = CreateProgram(vsQuantized, fsReflect);
+    GLuint shaderRefractQuantized = CreateProgram(vsQuantized, fsRefract);
+
     // Our obj file defines tcoords as 0 = bottom, 1 = top, but OpenGL defines as 0 = top 1 = bottom.
     // Flipping our image vertically is the best way to solve this as it ensures a "one-stop" solution (rather than an in-shader solution).
     stbi_set_flip_vertically_on_load(true);
@@ -272,8 +307,17 @@ int main(void)
     bool texToggle = false;
     bool camToggle = false;
 
-    Mesh headMesh, asteroidMesh, cubeMesh, sphereMesh;
-    CreateMesh(&headMesh, "assets/meshes/head.obj");
+    // The head streams in on a worker thread & is skipped until it's resident, the rest are needed immediately
+    MeshStreamer streamer;
+    CreateStreamer(&streamer);
+    int headHandle = RequestMesh(&streamer, "assets/meshes/head.obj", LAYOUT_QUANTIZED);
+
+    // Resident meshes share one arena, so back to back draws of them never switch VAOs.
+    // Every mesh is quantized (16-byte vertices instead of 32) & drawn with the *Quantized programs.
+    GeometryArena arena;
+    CreateArena(&arena, 1 << 18, 1 << 20, LAYOUT_QUANTIZED);
+    Mesh asteroidMesh, cubeMesh, sphereMesh;
+    asteroidMesh.arena = cubeMesh.arena = sphereMesh.arena = &arena;
     CreateMesh(&asteroidMesh, "assets/meshes/asteroid.obj");
     CreateMesh(&cubeMesh, CUBE);
     CreateMesh(&sphereMesh, SPHERE);
@@ -294,16 +338,41 @@ int main(void)
     float refractiveIndex = 1.52f; // 1.52 = glass
 
     std::vector<Matrix> asteroids(100);
+    std::vector<float> angles(asteroids.size()), sines(asteroids.size()), cosines(asteroids.size());
+    for (int i = 0; i < asteroids.size(); i++)
+        angles[i] = (float)i / (float)asteroids.size() * 2.0f * PI;
+    SinCos(angles.data(), sines.data(), cosines.data(), (int)angles.size());
+
     for (int i = 0; i < asteroids.size(); i++)
     {
-        float angle = (float)i / (float)asteroids.size() * 2.0f * PI;
         float min = 40.0f;
         float max = 60.0f;
 
         // Extra practice: give each asteroid a random rotation and scale!
-        asteroids[i] = Translate(sinf(angle) * Random(min, max), 0.0f, cosf(angle) * Random(min, max));
+        asteroids[i] = Translate(sines[i] * Random(min, max), 0.0f, cosines[i] * Random(min, max));
     }
 
+    // Asteroid bounding spheres (SoA) in the field's space for frustum culling
+    std::vector<float> asteroidX(asteroids.size()), asteroidY(asteroids.size()), asteroidZ(asteroids.size());
+    std::vector<float> asteroidRadii(asteroids.size());
+    TransformSpheres(asteroids.data(), (int)asteroids.size(), asteroidMesh.sphereCenter, asteroidMesh.sphereRadius,
+        asteroidX.data(), asteroidY.data(), asteroidZ.data(), asteroidRadii.data());
+    std::vector<int> visibleAsteroids(asteroids.size());
+    // Per-frame data (ie batched draws) is streamed through a persistently mapped ring instead of buffer uploads
+    // and sized so the asteroid batch fits even with every asteroid visible (split meshes take a command per range)
+    int asteroidCommands = (int)asteroids.size() * std::max((int)asteroidMesh.ranges.size(), 1);
+    RingBuffer ring;
+    CreateRingBuffer(&ring, (4 << 20) + BatchRingSize(asteroidCommands));
+    DrawBatch asteroidBatch;
+    CreateBatch(&asteroidBatch, &arena, &ring, asteroidCommands);
+
+    // Every asteroid shares one triangle BVH, placed by its world matrix in the field's instance BVH
+    MeshBvh asteroidBvh;
+    BuildBvh(&asteroidBvh, asteroidMesh);
+    std::vector<const MeshBvh*> asteroidBvhs(asteroids.size(), &asteroidBvh);
+    InstanceBvh fieldBvh;
+    BuildBvh(&fieldBvh, asteroidBvhs.data(), asteroids.data(), (int)asteroids.size());
+
     // Render looks weird cause this isn't enabled, but its causing unexpected problems which I'll fix soon!
     glEnable(GL_DEPTH_TEST);
     glDepthFunc(GL_LEQUAL);
@@ -313,14 +382,20 @@ int main(void)
     float dt = 0.0f;
 
     double pmx = 0.0, pmy = 0.0, mx = 0.0, my = 0.0;
+    bool leftPrev = false, leftCurr = false;
     /* Loop until the user closes the window */
     while (!glfwWindowShouldClose(window))
     {
         float time = glfwGetTime();
         timePrev = time;
 
+        BeginRingFrame(&ring);
+
         pmx = mx; pmy = my;
         glfwGetCursorPos(window, &mx, &my);
+        leftPrev = leftCurr;
+        leftCurr = glfwGetMouseButton(window, GLFW_MOUSE_BUTTON_LEFT) == GLFW_PRESS;
+        bool leftClicked = leftCurr && !leftPrev && !ImGui::GetIO().WantCaptureMouse;
         Vector2 mouseDelta = { mx - pmx, my - pmy };
 
         // Change object when space is pressed
@@ -407,12 +482,17 @@ int main(void)
         GLuint shaderProgram = GL_NONE;
         GLuint textureTest = texToggle ? texGradient : texHead;
 
+        // Only the cases that draw the head acquire it, so it can be evicted while the others are shown
+        UpdateStreamer(&streamer);
+        const Mesh* headMesh = nullptr;
+
         switch (object + 1)
         {
         // Left side: object with texture applied to it
         // Right side: the coordinates our object uses to sample its texture
         case 1:
-            shaderProgram = shaderTexture;
+            headMesh = AcquireMesh(&streamer, headHandle);
+            shaderProgram = shaderTextureQuantized;
             glUseProgram(shaderProgram);
             world = objectMatrix;
             mvp = world * view * proj;
@@ -421,19 +501,28 @@ int main(void)
             SendInt(shaderProgram, "u_tex", 0);
             glActiveTexture(GL_TEXTURE0);
             glBindTexture(GL_TEXTURE_2D, textureTest);
-            DrawMesh(headMesh);
+            if (headMesh != nullptr)
+            {
+                SendMat4(shaderProgram, "u_dequantize", headMesh->dequantize);
+                DrawMeshCulled(*headMesh, world, view, proj, camPos);
+            }
 
-            shaderProgram = shaderTcoords;
+            shaderProgram = shaderTcoordsQuantized;
             glUseProgram(shaderProgram);
             world = rotationX * Translate(2.5f, 0.0f, 0.0f);
             mvp = world * view * proj;
             SendMat4(shaderProgram, "u_mvp", mvp);
-            DrawMesh(headMesh);
+            if (headMesh != nullptr)
+            {
+                SendMat4(shaderProgram, "u_dequantize", headMesh->dequantize);
+                DrawMeshCulled(*headMesh, world, view, proj, camPos);
+            }
             break;
 
         // Interpolating (lerping) between 2 textures:
         case 2:
-            shaderProgram = shaderTextureMix;
+            headMesh = AcquireMesh(&streamer, headHandle);
+            shaderProgram = shaderTextureMixQuantized;
             glUseProgram(shaderProgram);
             
             mvp = world * view * proj;
@@ -448,16 +537,20 @@ int main(void)
             glActiveTexture(GL_TEXTURE1);
             glBindTexture(GL_TEXTURE_2D, texHead);
             
-            DrawMesh(headMesh);
+            if (headMesh != nullptr)
+            {
+                SendMat4(shaderProgram, "u_dequantize", headMesh->dequantize);
+                DrawMeshCulled(*headMesh, world, view, proj, camPos);
+            }
             break;
 
         // Phong
         case 3:
-            shaderProgram = shaderPhong;
+            shaderProgram = shaderPhongQuantized;
             glUseProgram(shaderProgram);
             world = objectMatrix;
             mvp = world * view * proj;
-            normal = Transpose(Invert(world));
+            normal = NormalMatrix(world);
             
             SendMat3(shaderProgram, "u_normal", normal);
             SendMat4(shaderProgram, "u_world", world);
@@ -472,16 +565,18 @@ int main(void)
             SendFloat(shaderProgram, "u_ambientFactor", ambientFactor);
             SendFloat(shaderProgram, "u_diffuseFactor", diffuseFactor);
             SendFloat(shaderProgram, "u_specularPower", specularPower);
+            SendMat4(shaderProgram, "u_dequantize", sphereMesh.dequantize);
             
             DrawMesh(sphereMesh);
             
             // Visualize light as wireframe
-            shaderProgram = shaderUniformColor;
+            shaderProgram = shaderUniformColorQuantized;
             glUseProgram(shaderProgram);
             world = Scale(V3_ONE * lightRadius) * Translate(lightPosition);
             mvp = world * view * proj;
 
             SendMat4(shaderProgram, "u_mvp", mvp);
+            SendMat4(shaderProgram, "u_dequantize", sphereMesh.dequantize);
             SendVec3(shaderProgram, "u_color", lightColor);
 
             glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
@@ -494,20 +589,21 @@ int main(void)
         // Extra practice 2 - Add FPS camera to see all 6 faces of the skybox!
         // Extra practice 3 - Add FPS controls to objects & make a key to cycle between controlling reflected vs refracted object
         case 4:
-            DrawSkybox(texSkyboxArctic, shaderSkybox, cubeMesh, view, proj);
+            DrawSkybox(texSkyboxArctic, shaderSkyboxQuantized, cubeMesh, view, proj);
 
         // Reflect begin
-            shaderProgram = shaderReflect;
+            shaderProgram = shaderReflectQuantized;
             glUseProgram(shaderProgram);
 
             world = Translate(-2.0f, 0.0f, 0.0f);
             mvp = world * view * proj;
-            normal = Transpose(Invert(world));
+            normal = NormalMatrix(world);
 
             SendMat3(shaderProgram, "u_normal", normal);
             SendMat4(shaderProgram, "u_world", world);
             SendMat4(shaderProgram, "u_mvp", mvp);
             SendVec3(shaderProgram, "u_cameraPosition", camPos);
+            SendMat4(shaderProgram, "u_dequantize", cubeMesh.dequantize);
 
             glBindTexture(GL_TEXTURE_CUBE_MAP, texSkyboxArctic);
             DrawMesh(cubeMesh);
@@ -515,18 +611,19 @@ int main(void)
         // Reflect end
 
         // Refract begin
-            shaderProgram = shaderRefract;
+            shaderProgram = shaderRefractQuantized;
             glUseProgram(shaderProgram);
 
             world = Translate(2.0f, 0.0f, 0.0f);
             mvp = world * view * proj;
-            normal = Transpose(Invert(world));
+            normal = NormalMatrix(world);
 
             SendMat3(shaderProgram, "u_normal", normal);
             SendMat4(shaderProgram, "u_world", world);
             SendMat4(shaderProgram, "u_mvp", mvp);
             SendVec3(shaderProgram, "u_cameraPosition", camPos);
             SendFloat(shaderProgram, "u_ratio", 1.00f / refractiveIndex);
+            SendMat4(shaderProgram, "u_dequantize", cubeMesh.dequantize);
 
             glBindTexture(GL_TEXTURE_CUBE_MAP, texSkyboxArctic);
             DrawMesh(cubeMesh);
@@ -536,20 +633,55 @@ int main(void)
 
         // Applies a texture to our object
         case 5:
-            DrawSkybox(texSkyboxSpace, shaderSkybox, cubeMesh, view, proj);
+            DrawSkybox(texSkyboxSpace, shaderSkyboxQuantized, cubeMesh, view, proj);
 
             shaderProgram = shaderAsteroids;
             glUseProgram(shaderProgram);
             mvp = world * view * proj;
 
-            SendMat4(shaderProgram, "u_orbit", RotateY(5.0f * timeCurr * DEG2RAD));
-            SendMat4Array(shaderProgram, "u_world", asteroids.data(), asteroids.size());
-            SendMat4(shaderProgram, "u_mvp", mvp);
-            SendInt(shaderProgram, "u_tex", 0);
-            glActiveTexture(GL_TEXTURE0);
-            glBindTexture(GL_TEXTURE_2D, texAsteroid);
-
-            DrawMeshInstanced(asteroidMesh, 100);
+            {
+                // Cull in the asteroid field's space (orbit * mvp), then only upload & draw the visible instances
+                Matrix orbit = RotateY(5.0f * timeCurr * DEG2RAD);
+                ViewFrustum frustum = ExtractFrustum(orbit * mvp);
+                int visibleCount = CullSpheres(frustum, asteroidX.data(), asteroidY.data(), asteroidZ.data(), asteroidRadii.data(),
+                    (int)asteroids.size(), visibleAsteroids.data());
+
+                // Each visible asteroid is its own indirect command at the LOD its distance calls for (nearest point of its
+                // bounding sphere), and the whole field goes out in one glMultiDrawElementsIndirect
+                Matrix fieldToWorld = orbit * world;
+                float lodScale = ProjectionScale(fov, SCREEN_HEIGHT);
+                for (int i = 0; i < visibleCount; i++)
+                {
+                    int index = visibleAsteroids[i];
+                    Vector3 center = Multiply(Vector3{ asteroidX[index], asteroidY[index], asteroidZ[index] }, fieldToWorld);
+                    float distance = Max(Length(center - camPos) - asteroidRadii[index], near);
+                    AddDraw(&asteroidBatch, asteroidMesh, asteroids[index], SelectLod(asteroidMesh, distance, lodScale));
+                }
+
+                SendMat4(shaderProgram, "u_orbit", orbit);
+                SendMat4(shaderProgram, "u_mvp", mvp);
+                SendInt(shaderProgram, "u_tex", 0);
+                glActiveTexture(GL_TEXTURE0);
+                glBindTexture(GL_TEXTURE_2D, texAsteroid);
+                SubmitBatch(&asteroidBatch);
+
+                // Click to pick: unprojecting through orbit * world * view puts the cursor ray straight into the field's space
+                if (leftClicked && !camToggle)
+                {
+                    double pickStart = glfwGetTime();
+                    float ndcX = (float)mx / SCREEN_WIDTH * 2.0f - 1.0f;
+                    float ndcY = 1.0f - (float)my / SCREEN_HEIGHT * 2.0f;
+                    Matrix fieldView = fieldToWorld * view;
+                    Vector3 rayNear = Unproject({ ndcX, ndcY, -1.0f }, proj, fieldView);
+                    Vector3 rayFar = Unproject({ ndcX, ndcY, 1.0f }, proj, fieldView);
+
+                    RayHit hit;
+                    if (Intersect(fieldBvh, { rayNear, rayFar - rayNear }, &hit))
+                        printf("Picked asteroid %i, triangle %i (%.3f ms)\n", hit.instance, hit.triangle, (glfwGetTime() - pickStart) * 1000.0);
+                    else
+                        printf("Picked nothing (%.3f ms)\n", (glfwGetTime() - pickStart) * 1000.0);
+                }
+            }
             break;
         }
 
@@ -595,6 +727,8 @@ int main(void)
         timeCurr = glfwGetTime();
         dt = timeCurr - timePrev;
 
+        EndRingFrame(&ring);
+
         /* Swap front and back buffers */
         glfwSwapBuffers(window);
 
@@ -603,6 +737,10 @@ int main(void)
         glfwPollEvents();
     }
 
+    DestroyStreamer(&streamer);
+    DestroyBatch(&asteroidBatch);
+    DestroyRingBuffer(&ring);
+    DestroyArena(&arena);
     ImGui_ImplOpenGL3_Shutdown();
     ImGui_ImplGlfw_Shutdown();
     ImGui::DestroyContext();